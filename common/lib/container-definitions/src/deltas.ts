@@ -46,6 +46,13 @@ export interface IDeltaHandlerStrategy {
      */
     process: (message: ISequencedDocumentMessage) => void;
 
+    /**
+     * If provided, processes a contiguous run of sequenced messages in a single call.  The
+     * delta manager uses this in place of per-message `process` calls when draining a backlog
+     * (e.g. catch-up after reconnect), so implementations can amortize per-message overhead.
+     */
+    processBatch?: (messages: ISequencedDocumentMessage[]) => void;
+
     /**
      * Processes the signal.
      */
@@ -52,6 +52,12 @@ export interface IConnect {
      * for connection to be successful.
      */
     epoch?: string;
+
+    /**
+     * An optional map of features the client supports, keyed by feature name (e.g. alternate
+     * wire encodings for op delivery). Servers that do not understand the map ignore it.
+     */
+    supportedFeatures?: Record<string, boolean>;
 }
 
 /**
@@ -131,4 +137,10 @@ export interface IConnected {
      * Represents the version of document at server.
      */
     epoch?: string;
+
+    /**
+     * An optional map of features the server has enabled for this connection, echoing the
+     * subset of the client's supportedFeatures that the server also understands.
+     */
+    supportedFeatures?: Record<string, boolean>;
 }
@@ -269,6 +269,108 @@ function serializeDirectory(root: SubDirectory, serializer: IFluidSerializer): I
     return tree;
 }
 
+/**
+ * 32-bit FNV-1a hash of the given string, as a hex string.
+ * Used to give chunk blobs content-derived names, so an unchanged subdirectory produces a
+ * byte-identical summary entry (same name, same content) that storage can de-duplicate.
+ */
+function hashChunkContent(content: string): string {
+    let hash = 0x811c9dc5;
+    for (let i = 0; i < content.length; i++) {
+        hash ^= content.charCodeAt(i);
+        hash = Math.imul(hash, 0x01000193);
+    }
+    // eslint-disable-next-line no-bitwise
+    return (hash >>> 0).toString(16);
+}
+
+/**
+ * Chunked variant of serializeDirectory: instead of rolling the whole subdirectory tree into a
+ * single header blob, each subdirectory's storage above a size threshold becomes its own blob
+ * named by a hash of its content. A subdirectory that did not change serializes to the exact
+ * same blob as in the previous summary, so storage-level blob de-duplication re-uploads only
+ * the chunks that actually changed. The header keeps the subdirectory skeleton and any small
+ * storage inline, and loads through the same loadCore path as the existing format.
+ */
+function serializeDirectoryChunked(root: SubDirectory, serializer: IFluidSerializer): ITree {
+    // Subdirectories whose serialized storage is below this size stay inline in the header.
+    // Balances chunk count (storage prefers fewer, bigger blobs) against re-upload granularity.
+    const MinChunkSizeSeparateSnapshotBlob = 2 * 1024;
+
+    const tree: ITree = { entries: [] };
+    const blobs: string[] = [];
+    const usedBlobNames = new Set<string>();
+
+    const stack: [SubDirectory, IDirectoryDataObject][] = [];
+    const content: IDirectoryDataObject = {};
+    stack.push([root, content]);
+
+    while (stack.length > 0) {
+        // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+        const [currentSubDir, currentSubDirObject] = stack.pop()!;
+
+        let size = 0;
+        let storage: { [key: string]: ISerializableValue } | undefined;
+        for (const [key, value] of currentSubDir.getSerializedStorage(serializer)) {
+            if (!storage) {
+                storage = {};
+            }
+            storage[key] = {
+                type: value.type,
+                // eslint-disable-next-line @typescript-eslint/ban-types
+                value: value.value && JSON.parse(value.value) as object,
+            };
+            size += key.length + (value.value?.length ?? 0);
+        }
+
+        if (storage !== undefined) {
+            if (size >= MinChunkSizeSeparateSnapshotBlob) {
+                // Emit this subdirectory's storage as its own blob, rooted at its absolute path
+                // so that populate() can replay it independently of the header.
+                const chunk: IDirectoryDataObject = {};
+                let chunkContent = chunk;
+                if (currentSubDir.absolutePath !== posix.sep) {
+                    for (const dir of currentSubDir.absolutePath.substr(1).split(posix.sep)) {
+                        const subDataObject: IDirectoryDataObject = {};
+                        chunkContent.subdirectories = { [dir]: subDataObject };
+                        chunkContent = subDataObject;
+                    }
+                }
+                chunkContent.storage = storage;
+
+                let blobName = `chunk_${hashChunkContent(JSON.stringify(chunk))}`;
+                // Distinct subdirectories can hash to the same name (identical content or a
+                // hash collision) - blob names within the tree must still be unique.
+                while (usedBlobNames.has(blobName)) {
+                    blobName = `${blobName}_`;
+                }
+                usedBlobNames.add(blobName);
+                blobs.push(blobName);
+                addBlobToTree(tree, blobName, chunk);
+            } else {
+                currentSubDirObject.storage = storage;
+            }
+        }
+
+        for (const [subdirName, subdir] of currentSubDir.subdirectories()) {
+            if (!currentSubDirObject.subdirectories) {
+                currentSubDirObject.subdirectories = {};
+            }
+            const subDataObject: IDirectoryDataObject = {};
+            currentSubDirObject.subdirectories[subdirName] = subDataObject;
+            stack.push([subdir as SubDirectory, subDataObject]);
+        }
+    }
+
+    const newFormat: IDirectoryNewStorageFormat = {
+        blobs,
+        content,
+    };
+    addBlobToTree(tree, snapshotFileName, newFormat);
+
+    return tree;
+}
+
 /**
  * The factory that defines the directory.
  * @sealed
@@ -566,6 +668,9 @@ export class SharedDirectory extends SharedObject<ISharedDirectoryEvents> implem
      * {@inheritDoc @fluidframework/shared-object-base#SharedObject.snapshotCore}
      */
     protected snapshotCore(serializer: IFluidSerializer): ITree {
+        if (this.runtime.options?.directoryChunkedSnapshotFormat === true) {
+            return serializeDirectoryChunked(this.root, serializer);
+        }
         return serializeDirectory(this.root, serializer);
     }
 
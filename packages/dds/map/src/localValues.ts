@@ -92,6 +92,80 @@ export class PlainLocalValue implements ILocalValue {
     }
 }
 
+/**
+ * Migrates a value serialized in the legacy Shared format into the equivalent Plain handle
+ * reference, in place. No-op for values already in the Plain format.
+ */
+function migrateIfSharedSerializable(serializable: ISerializableValue): void {
+    // Migrate from old shared value to handles
+    if (serializable.type === ValueType[ValueType.Shared]) {
+        serializable.type = ValueType[ValueType.Plain];
+        const handle: ISerializedHandle = {
+            type: "__fluid_handle__",
+            url: serializable.value as string,
+        };
+        serializable.value = handle;
+    }
+}
+
+/**
+ * A local value that defers conversion of its serialized form (JSON reification and handle
+ * decoding) until the first read of the contained value. Used on the load path so that boot
+ * cost scales with the keys the app actually reads, rather than with the total key count.
+ * Enumerating keys does not materialize the value; summarizing does, so that contained handles
+ * pass through the serializer.
+ */
+export class LazyLocalValue implements ILocalValue {
+    private materialized: ILocalValue | undefined;
+
+    /**
+     * Create a new LazyLocalValue.
+     * @param serializable - The serializable value to materialize on first read
+     * @param maker - The maker used to materialize the value
+     */
+    constructor(
+        private readonly serializable: ISerializableValue,
+        private readonly maker: LocalValueMaker,
+    ) {
+        migrateIfSharedSerializable(serializable);
+    }
+
+    /**
+     * {@inheritDoc ILocalValue."type"}
+     */
+    public get type(): string {
+        return this.serializable.type;
+    }
+
+    /**
+     * The in-memory value stored within, materialized from the serialized form on first access.
+     */
+    public get value(): any {
+        if (this.materialized === undefined) {
+            this.materialized = this.maker.fromSerializable(this.serializable);
+        }
+        return this.materialized.value;
+    }
+
+    /**
+     * {@inheritDoc ILocalValue.makeSerialized}
+     */
+    public makeSerialized(
+        serializer: IFluidSerializer,
+        bind: IFluidHandle,
+    ): ISerializedValue {
+        if (this.materialized === undefined) {
+            // The raw form round-trips to the same wire shape that materializing and
+            // re-serializing would produce, but garbage collection depends on the serializer
+            // seeing every contained handle: SharedObject.getGCData collects outbound routes
+            // from the handles serialized during summarize. So materialize here rather than
+            // echoing the raw JSON back, or unread handle-bearing keys would lose their routes.
+            this.materialized = this.maker.fromSerializable(this.serializable);
+        }
+        return this.materialized.makeSerialized(serializer, bind);
+    }
+}
+
 /**
  * A LocalValueMaker enables a container type DDS to produce and store local values with minimal awareness of how
  * those objects are stored, serialized, and deserialized.
@@ -109,15 +183,7 @@ export class LocalValueMaker {
      * @param serializable - The serializable value to make local
      */
     public fromSerializable(serializable: ISerializableValue): ILocalValue {
-        // Migrate from old shared value to handles
-        if (serializable.type === ValueType[ValueType.Shared]) {
-            serializable.type = ValueType[ValueType.Plain];
-            const handle: ISerializedHandle = {
-                type: "__fluid_handle__",
-                url: serializable.value as string,
-            };
-            serializable.value = handle;
-        }
+        migrateIfSharedSerializable(serializable);
 
         const translatedValue = parseHandles(serializable.value, this.serializer);
 
@@ -15,6 +15,7 @@ import {
 } from "./interfaces";
 import {
     ILocalValue,
+    LazyLocalValue,
     LocalValueMaker,
     makeSerializable,
 } from "./localValues";
@@ -402,16 +403,20 @@ export class MapKernel {
 
     /**
      * Populate the kernel with the given map data.
+     * Entries are stored lazily: the serialized form is kept per key and only deserialized
+     * (JSON reification, handle decoding) on first read, so load cost scales with the keys
+     * actually read at boot rather than with the size of the map. Enumerating keys does not
+     * materialize values.
      * @param data - A JSON string containing serialized map data
      */
     public populateFromSerializable(json: IMapDataObjectSerializable): void {
         for (const [key, serializable] of Object.entries(json)) {
-            const localValue = {
-                key,
-                value: this.makeLocal(key, serializable),
-            };
-
-            this.data.set(localValue.key, localValue.value);
+            // Unknown types should still fail at load time, not at first read.
+            if (serializable.type !== ValueType[ValueType.Plain] &&
+                serializable.type !== ValueType[ValueType.Shared]) {
+                throw new Error("Unknown local value type");
+            }
+            this.data.set(key, new LazyLocalValue(serializable, this.localValueMaker));
         }
     }
 
@@ -1261,4 +1261,74 @@ describe("Directory", () => {
 
         runGCTests(GCSharedDirectoryProvider);
     });
+
+    describe("Chunked snapshot format", () => {
+        function createChunkedDirectory(id: string): SharedDirectory {
+            const dataStoreRuntime = new MockFluidDataStoreRuntime();
+            dataStoreRuntime.options = { directoryChunkedSnapshotFormat: true };
+            return new SharedDirectory(id, dataStoreRuntime, DirectoryFactory.Attributes);
+        }
+
+        function fillSubDirectory(directory: SharedDirectory, subdirName: string, marker: string) {
+            const subdir = directory.getSubDirectory(subdirName) ?? directory.createSubDirectory(subdirName);
+            for (let i = 0; i < 100; i++) {
+                subdir.set(`key${i}`, `${marker}_value${i}`);
+            }
+        }
+
+        it("Should emit one content-named blob per large subdirectory and roundtrip", async () => {
+            const directory = createChunkedDirectory("chunked");
+            directory.set("small", "stays inline");
+            fillSubDirectory(directory, "left", "left");
+            fillSubDirectory(directory, "right", "right");
+
+            const summarizeResult = directory.summarize();
+            const summaryTree = summarizeResult.summary;
+            const header = summaryTree.tree.header as ISummaryBlob;
+            assert(header !== undefined, "header not present in summary");
+            const headerContent = JSON.parse(header.content as string) as IDirectoryNewStorageFormat;
+            assert.strictEqual(headerContent.blobs.length, 2, "expected a chunk blob per large subdirectory");
+            for (const blobName of headerContent.blobs) {
+                assert(blobName.startsWith("chunk_"), "chunk blobs should be content-named");
+                assert(summaryTree.tree[blobName] !== undefined, `blob ${blobName} missing from summary`);
+            }
+            // Small root storage stays inline in the header.
+            assert(headerContent.content.storage?.small !== undefined, "small key should stay in the header");
+
+            const directory2 = new SharedDirectory(
+                "chunked2", new MockFluidDataStoreRuntime(), DirectoryFactory.Attributes);
+            await directory2.load(MockSharedObjectServices.createFromSummary(summaryTree));
+            assert.equal(directory2.get("small"), "stays inline");
+            assert.equal(directory2.getWorkingDirectory("/left")?.get("key7"), "left_value7");
+            assert.equal(directory2.getWorkingDirectory("/right")?.get("key42"), "right_value42");
+        });
+
+        it("Should keep chunk blobs for unchanged subdirectories byte-identical across summaries", () => {
+            const directory = createChunkedDirectory("chunked");
+            fillSubDirectory(directory, "stable", "stable");
+            fillSubDirectory(directory, "churning", "before");
+
+            const firstTree = directory.summarize().summary;
+            const firstBlobs =
+                (JSON.parse((firstTree.tree.header as ISummaryBlob).content as string) as IDirectoryNewStorageFormat)
+                    .blobs;
+
+            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+            directory.getSubDirectory("churning")!.set("key0", "after_value0");
+            const secondTree = directory.summarize().summary;
+            const secondBlobs =
+                (JSON.parse((secondTree.tree.header as ISummaryBlob).content as string) as IDirectoryNewStorageFormat)
+                    .blobs;
+
+            const unchanged = firstBlobs.filter((name) => secondBlobs.includes(name));
+            assert.strictEqual(unchanged.length, 1, "unchanged subdirectory should keep its chunk name");
+            assert.strictEqual(
+                (firstTree.tree[unchanged[0]] as ISummaryBlob).content,
+                (secondTree.tree[unchanged[0]] as ISummaryBlob).content,
+                "unchanged chunk should be byte-identical");
+            assert.strictEqual(
+                firstBlobs.filter((name) => !secondBlobs.includes(name)).length, 1,
+                "changed subdirectory should produce a new chunk");
+        });
+    });
 });
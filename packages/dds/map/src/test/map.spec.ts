@@ -257,6 +257,45 @@ describe("Map", () => {
                 assert(loadedMap.get("longValue") === longString);
                 assert(loadedMap.get("zzz") === "the end");
             });
+
+            it("can enumerate keys without materializing values and re-summarize unchanged", async () => {
+                map.set("first", "one");
+                map.set("second", { nested: "two" });
+
+                const summaryContent = (map.summarize().summary.tree.header as ISummaryBlob).content;
+                const services = new MockSharedObjectServices({ header: summaryContent });
+                const factory = new MapFactory();
+                const loadedMap = await factory.load(
+                    new MockFluidDataStoreRuntime(), "mapId", services, factory.attributes,
+                );
+
+                // Key enumeration operates on the still-serialized entries.
+                assert.deepStrictEqual([...loadedMap.keys()], ["first", "second"], "keys should enumerate");
+                const reloadedContent = (loadedMap.summarize().summary.tree.header as ISummaryBlob).content;
+                assert.strictEqual(reloadedContent, summaryContent, "unread entries should re-serialize unchanged");
+
+                // Values still materialize correctly on first read.
+                assert.strictEqual(loadedMap.get("first"), "one");
+                assert.deepStrictEqual(loadedMap.get("second"), { nested: "two" });
+            });
+
+            it("reports GC routes for handles in keys that were never read", async () => {
+                const subMap = createLocalMap("subMap");
+                map.set("unread", { subMapHandle: subMap.handle });
+                const subMapHandleUrl = subMap.handle.absolutePath;
+
+                const summaryContent = (map.summarize().summary.tree.header as ISummaryBlob).content;
+                const services = new MockSharedObjectServices({ header: summaryContent });
+                const factory = new MapFactory();
+                const loadedMap = await factory.load(
+                    new MockFluidDataStoreRuntime(), "mapId", services, factory.attributes,
+                );
+
+                // Do not read "unread" - GC must still see the handle routes of lazy entries.
+                const gcData = loadedMap.getGCData();
+                assert.deepStrictEqual(
+                    gcData.gcNodes["/"], [subMapHandleUrl], "unread key's handle should be a GC route");
+            });
         });
 
         describe("Op processing", () => {
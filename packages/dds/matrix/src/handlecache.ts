@@ -8,7 +8,7 @@
 import { assert } from "@fluidframework/common-utils";
 import { IVectorConsumer } from "@tiny-calc/nano";
 import { Handle, isHandleValid } from "./handletable";
-import { PermutationVector, PermutationSegment } from "./permutationvector";
+import { PermutationVector } from "./permutationvector";
 import { ensureRange } from "./range";
 
 /**
@@ -66,22 +66,30 @@ export class HandleCache implements IVectorConsumer<Handle> {
         }
     }
 
-    /** Used by 'CacheMiss()' to retrieve handles for a range of positions. */
-    private getHandles(start: number, end: number) {
-        // TODO: This can be accelerated substantially using 'walkSegments()'.  The only catch
-        //       is that
-
-        const handles: Handle[] = [];
-        const { vector } = this;
-
-        for (let pos = start; pos < end; pos++) {
-            const { segment, offset } = vector.getContainingSegment(pos);
-            const asPerm = segment as PermutationSegment;
-            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
-            handles.push(asPerm.start + offset!);
+    /**
+     * Drops all cached entries at and after the given 'position' so they are re-resolved from
+     * the merge-tree on the next read.  Used when handles change without a corresponding vector
+     * delta, e.g. when undo transfers handles onto a reinserted segment after the insertion was
+     * already announced via 'itemsChanged()'.
+     */
+    public invalidateFrom(position: number): void {
+        if (position <= this.start) {
+            this.handles.length = 0;
+            this.start = position;
+            return;
+        }
+
+        const index = position - this.start;
+        if (index < this.handles.length) {
+            this.handles.length = index;
         }
+    }
 
-        return handles;
+    /** Used by 'CacheMiss()' to retrieve handles for a range of positions. */
+    private getHandles(start: number, end: number): Handle[] {
+        // Bulk resolution walks the tree once for the whole range instead of performing an
+        // independent 'getContainingSegment()' search per position.
+        return Array.from(this.vector.getHandleRange(start, end));
     }
 
     private cacheMiss(position: number) {
@@ -111,21 +119,50 @@ export class HandleCache implements IVectorConsumer<Handle> {
     // #region IVectorConsumer
 
     itemsChanged(start: number, removedCount: number, insertedCount: number): void {
-        // If positions were inserted/removed, our current policy is to trim the array
-        // at the beginning of the invalidate range and lazily repopulate the handles
-        // on demand.
+        // Adjust only the affected range of the cache rather than discarding everything at and
+        // after 'start':
         //
-        // Some alternatives to consider that preserve the previously cached handles
-        // that are still valid:
+        //      * Removed positions are spliced out of the cache.
         //
-        //      * Eagerly populate the 'handles[]' with the newly insert values (currently guaranteed
-        //        to be Handle.unallocated, so we don't even need to look them up.)
+        //      * Inserted positions are spliced in as Handle.unallocated, which is currently
+        //        guaranteed to be their value (remote handle allocations are reset before this
+        //        notification, and local allocations happen after insertion.)
         //
-        //      * Use a sentinel value or other mechanism to allow "holes" in the cache.
+        // Handles cached for positions after the change remain valid at their shifted locations.
 
-        const index = this.getIndex(start);
-        if (index < this.handles.length) {
-            this.handles.length =  index;
+        const removedEnd = start + removedCount;
+
+        if (removedEnd <= this.start) {
+            // The change is entirely before the cached window.  Shift the window to keep the
+            // cached handles aligned with their new positions.
+            this.start += insertedCount - removedCount;
+            return;
+        }
+
+        if (start >= this.start + this.handles.length) {
+            // The change is entirely after the cached window.
+            return;
+        }
+
+        if (start < this.start) {
+            // The removed range overlaps the beginning of the cached window.  Drop the overlapped
+            // head and realign the window with the surviving entries.
+            this.handles.splice(0, removedEnd - this.start);
+            this.start = start + insertedCount;
+            return;
+        }
+
+        const index = start - this.start;
+        this.handles.splice(index, removedCount);
+
+        // Note: Avoiding the spread operator with '.splice()' as it can exhaust the stack for
+        //       large insertions.  If the insertion is at the end of the cached window there is
+        //       no tail to preserve, and the new positions are lazily populated on demand.
+        if (insertedCount > 0 && index < this.handles.length) {
+            const tail = this.handles.splice(index);
+            this.handles = this.handles.concat(
+                new Array<Handle>(insertedCount).fill(Handle.unallocated),
+                tail);
         }
     }
 
@@ -68,6 +68,56 @@ interface ISetOpMetadata {
  */
 export type MatrixItem<T> = Serializable<Exclude<T, null>> | undefined;
 
+/**
+ * Aggregates over a single row or column of a SharedMatrix.
+ * (See SharedMatrix.getRowAggregates / getColAggregates.)
+ */
+export interface IMatrixAggregates {
+    /** Number of non-empty cells. */
+    count: number;
+
+    /** Sum of the cells containing numbers.  0 if there are none. */
+    sum: number;
+
+    /** Minimum of the cells containing numbers, or undefined if there are none. */
+    min: number | undefined;
+
+    /** Maximum of the cells containing numbers, or undefined if there are none. */
+    max: number | undefined;
+}
+
+/** Folds a single cell value into the given aggregates. */
+function accumulateAggregate(agg: IMatrixAggregates, value: unknown) {
+    if (value !== undefined) {
+        agg.count++;
+        if (typeof value === "number") {
+            agg.sum += value;
+            agg.min = agg.min === undefined || value < agg.min ? value : agg.min;
+            agg.max = agg.max === undefined || value > agg.max ? value : agg.max;
+        }
+    }
+}
+
+/**
+ * Incrementally adjusts the given aggregates for a cell changing from 'oldValue' to 'newValue'.
+ * Returns false when the adjustment cannot be made without a rescan (removing a cell that is
+ * the current min or max), in which case the caller should discard the aggregates.
+ */
+function adjustAggregate(agg: IMatrixAggregates, oldValue: unknown, newValue: unknown): boolean {
+    if (typeof oldValue === "number") {
+        // Min/max can not shrink incrementally - if the old value was an extreme, rescan.
+        if (oldValue === agg.min || oldValue === agg.max) {
+            return false;
+        }
+        agg.sum -= oldValue;
+    }
+    if (oldValue !== undefined) {
+        agg.count--;
+    }
+    accumulateAggregate(agg, newValue);
+    return true;
+}
+
 /**
  * A SharedMatrix holds a rectangular 2D array of values.  Supported operations
  * include setting values and inserting/removing rows and columns.
@@ -96,6 +146,12 @@ export class SharedMatrix<T = any>
     private cells = new SparseArray2D<MatrixItem<T>>();     // Stores cell values.
     private pending = new SparseArray2D<number>();          // Tracks pending writes.
 
+    // Memoized per-row/col aggregates, keyed by logical position.  Entries are adjusted
+    // incrementally as cells are written and discarded wholesale on row/col insertion/removal
+    // (which shifts logical positions and changes membership in the opposite dimension).
+    private readonly rowAggregateCache = new Map<number, IMatrixAggregates>();
+    private readonly colAggregateCache = new Map<number, IMatrixAggregates>();
+
     constructor(runtime: IFluidDataStoreRuntime, public id: string, attributes: IChannelAttributes) {
         super(id, runtime, attributes);
 
@@ -183,6 +239,57 @@ export class SharedMatrix<T = any>
 
     // #endregion IMatrixReader
 
+    /**
+     * Returns aggregates (non-empty count, numeric sum/min/max) over the given row.
+     * The result is memoized and maintained incrementally as cells are written, so repeated
+     * reads after point writes do not rescan the row.  Do not mutate the returned object.
+     */
+    public getRowAggregates(row: number): Readonly<IMatrixAggregates> {
+        ensureRange(row, this.rows.getLength());
+        let agg = this.rowAggregateCache.get(row);
+        if (agg === undefined) {
+            agg = { count: 0, sum: 0, min: undefined, max: undefined };
+            for (let col = this.cols.getLength() - 1; col >= 0; col--) {
+                accumulateAggregate(agg, this.getCell(row, col));
+            }
+            this.rowAggregateCache.set(row, agg);
+        }
+        return agg;
+    }
+
+    /**
+     * Returns aggregates (non-empty count, numeric sum/min/max) over the given col.
+     * The result is memoized and maintained incrementally as cells are written, so repeated
+     * reads after point writes do not rescan the col.  Do not mutate the returned object.
+     */
+    public getColAggregates(col: number): Readonly<IMatrixAggregates> {
+        ensureRange(col, this.cols.getLength());
+        let agg = this.colAggregateCache.get(col);
+        if (agg === undefined) {
+            agg = { count: 0, sum: 0, min: undefined, max: undefined };
+            for (let row = this.rows.getLength() - 1; row >= 0; row--) {
+                accumulateAggregate(agg, this.getCell(row, col));
+            }
+            this.colAggregateCache.set(col, agg);
+        }
+        return agg;
+    }
+
+    /**
+     * Maintains the memoized aggregates for a cell write at the given logical position.
+     * Cached entries are adjusted in place when possible and discarded otherwise.
+     */
+    private onCellWritten(row: number, col: number, oldValue: MatrixItem<T>, newValue: MatrixItem<T>) {
+        const rowAgg = this.rowAggregateCache.get(row);
+        if (rowAgg !== undefined && !adjustAggregate(rowAgg, oldValue, newValue)) {
+            this.rowAggregateCache.delete(row);
+        }
+        const colAgg = this.colAggregateCache.get(col);
+        if (colAgg !== undefined && !adjustAggregate(colAgg, oldValue, newValue)) {
+            this.colAggregateCache.delete(col);
+        }
+    }
+
     public setCell(row: number, col: number, value: MatrixItem<T>) {
         assert(0 <= row && row < this.rowCount
             && 0 <= col && col < this.colCount,
@@ -236,14 +343,14 @@ export class SharedMatrix<T = any>
         rowHandle = this.rows.getAllocatedHandle(row),
         colHandle = this.cols.getAllocatedHandle(col),
     ) {
-        if (this.undo !== undefined) {
-            let oldValue = this.cells.getCell(rowHandle, colHandle);
+        let oldValue = this.cells.getCell(rowHandle, colHandle);
 
-            // eslint-disable-next-line no-null/no-null
-            if (oldValue === null) {
-                oldValue = undefined;
-            }
+        // eslint-disable-next-line no-null/no-null
+        if (oldValue === null) {
+            oldValue = undefined;
+        }
 
+        if (this.undo !== undefined) {
             this.undo.cellSet(
                 rowHandle,
                 colHandle,
@@ -251,6 +358,7 @@ export class SharedMatrix<T = any>
         }
 
         this.cells.setCell(rowHandle, colHandle, value);
+        this.onCellWritten(row, col, oldValue, value);
 
         if (this.isAttached()) {
             this.sendSetCellOp(row, col, value, rowHandle, colHandle);
@@ -354,12 +462,11 @@ export class SharedMatrix<T = any>
         original.transferToReplacement(inserted);
 
         // Invalidate the handleCache in case it was populated during the 'rowsChanged'
-        // callback, which occurs before the handle span is populated.
+        // callback, which occurs before the handle span is populated.  Note that this must be
+        // a true invalidation: the insertion itself was already announced via 'itemsChanged()',
+        // and the transferred handles disagree with the Handle.unallocated entries it cached.
         const rowStart = this.rows.getPosition(inserted);
-        this.rows.handleCache.itemsChanged(
-            rowStart,
-            /* removedCount: */ 0,
-            /* insertedCount: */ inserted.cachedLength);
+        this.rows.handleCache.invalidateFrom(rowStart);
 
         // Generate setCell ops for each populated cell in the reinserted rows.
         let rowHandle = inserted.start;
@@ -398,12 +505,11 @@ export class SharedMatrix<T = any>
         original.transferToReplacement(inserted);
 
         // Invalidate the handleCache in case it was populated during the 'colsChanged'
-        // callback, which occurs before the handle span is populated.
+        // callback, which occurs before the handle span is populated.  Note that this must be
+        // a true invalidation: the insertion itself was already announced via 'itemsChanged()',
+        // and the transferred handles disagree with the Handle.unallocated entries it cached.
         const colStart = this.cols.getPosition(inserted);
-        this.cols.handleCache.itemsChanged(
-            colStart,
-            /* removedCount: */ 0,
-            /* insertedCount: */ inserted.cachedLength);
+        this.cols.handleCache.invalidateFrom(colStart);
 
         // Generate setCell ops for each populated cell in the reinserted cols.
         let colHandle = inserted.start;
@@ -643,7 +749,9 @@ export class SharedMatrix<T = any>
                             // since it "happened before" the pending write.
                             if (this.pending.getCell(rowHandle, colHandle) === undefined) {
                                 const { value } = contents;
+                                const oldValue = this.cells.getCell(rowHandle, colHandle);
                                 this.cells.setCell(rowHandle, colHandle, value);
+                                this.onCellWritten(adjustedRow, adjustedCol, oldValue, value);
 
                                 for (const consumer of this.consumers.values()) {
                                     consumer.cellsChanged(adjustedRow, adjustedCol, 1, 1, this);
@@ -663,6 +771,9 @@ export class SharedMatrix<T = any>
 
     // Invoked by PermutationVector to notify IMatrixConsumers of row insertion/deletions.
     private readonly onRowDelta = (position: number, removedCount: number, insertedCount: number) => {
+        this.rowAggregateCache.clear();
+        this.colAggregateCache.clear();
+
         for (const consumer of this.consumers) {
             consumer.rowsChanged(position, removedCount, insertedCount, this);
         }
@@ -670,6 +781,9 @@ export class SharedMatrix<T = any>
 
     // Invoked by PermutationVector to notify IMatrixConsumers of col insertion/deletions.
     private readonly onColDelta = (position: number, removedCount: number, insertedCount: number) => {
+        this.rowAggregateCache.clear();
+        this.colAggregateCache.clear();
+
         for (const consumer of this.consumers) {
             consumer.colsChanged(position, removedCount, insertedCount, this);
         }
@@ -26,6 +26,7 @@ import { ObjectStoragePartition } from "@fluidframework/runtime-utils";
 import { HandleTable, Handle, isHandleValid } from "./handletable";
 import { serializeBlob, deserializeBlob } from "./serialization";
 import { HandleCache } from "./handlecache";
+import { ensureRange } from "./range";
 import { VectorUndoProvider } from "./undoprovider";
 
 const enum SnapshotPath {
@@ -214,6 +215,48 @@ export class PermutationVector extends Client {
         return handle;
     }
 
+    /**
+     * Resolves the handles for the contiguous range of positions [start..end) with a single
+     * merge-tree walk, filling and returning an Int32Array. Positions whose segment has no
+     * allocated handle are filled with Handle.unallocated. Prefer this over per-position
+     * 'getMaybeHandle()' when reading a window of rows/cols (e.g. rendering a visible region).
+     *
+     * Throws a 'RangeError' if the provided range is out-of-bounds wrt. the vector's length.
+     */
+    public getHandleRange(start: number, end: number, handles = new Int32Array(end - start)): Int32Array {
+        if (start < end) {
+            ensureRange(start, this.getLength());
+            ensureRange(end - 1, this.getLength());
+        }
+
+        let index = 0;
+
+        this.walkSegments(
+            (segment, _pos, _refSeq, _clientId, segStart, segEnd) => {
+                const asPerm = segment as PermutationSegment;
+
+                // 'segStart'/'segEnd' are relative to the segment and unclipped: the range may
+                // begin before this segment (negative start) and/or end after it.
+                const first = Math.max(segStart, 0);
+                const last = Math.min(segEnd, asPerm.cachedLength);
+
+                if (isHandleValid(asPerm.start)) {
+                    for (let offset = first; offset < last; offset++) {
+                        handles[index++] = asPerm.start + offset;
+                    }
+                } else {
+                    for (let offset = first; offset < last; offset++) {
+                        handles[index++] = Handle.unallocated;
+                    }
+                }
+                return true;
+            },
+            start,
+            end);
+
+        return handles;
+    }
+
     public adjustPosition(pos: number, fromSeq: number, clientId: number) {
         const { segment, offset } = this.mergeTree.getContainingSegment(pos, fromSeq, clientId);
 
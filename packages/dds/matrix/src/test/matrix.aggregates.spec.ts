@@ -0,0 +1,97 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import {
+    MockFluidDataStoreRuntime,
+    MockContainerRuntimeFactory,
+    MockStorage,
+} from "@fluidframework/test-runtime-utils";
+import { SharedMatrix, SharedMatrixFactory } from "..";
+
+function createConnectedMatrix(id: string, runtimeFactory: MockContainerRuntimeFactory) {
+    const dataStoreRuntime = new MockFluidDataStoreRuntime();
+    const matrix = new SharedMatrix(dataStoreRuntime, id, SharedMatrixFactory.Attributes);
+    matrix.connect({
+        deltaConnection: runtimeFactory
+            .createContainerRuntime(dataStoreRuntime)
+            .createDeltaConnection(),
+        objectStorage: new MockStorage(),
+    });
+    return matrix;
+}
+
+function createLocalMatrix(id: string) {
+    const factory = new SharedMatrixFactory();
+    return factory.create(new MockFluidDataStoreRuntime(), id) as SharedMatrix<number>;
+}
+
+describe("Matrix", () => {
+    describe("row/col aggregates", () => {
+        let matrix: SharedMatrix<number>;
+
+        beforeEach(() => {
+            matrix = createLocalMatrix("aggregates");
+            matrix.insertRows(0, 4);
+            matrix.insertCols(0, 3);
+            // Column 0 gets 1, 2, 3, 4; column 2 gets a single value; column 1 stays empty.
+            for (let row = 0; row < 4; row++) {
+                matrix.setCell(row, 0, row + 1);
+            }
+            matrix.setCell(2, 2, 10);
+        });
+
+        it("computes count/sum/min/max over rows and cols", () => {
+            assert.deepEqual(matrix.getColAggregates(0), { count: 4, sum: 10, min: 1, max: 4 });
+            assert.deepEqual(matrix.getColAggregates(1), { count: 0, sum: 0, min: undefined, max: undefined });
+            assert.deepEqual(matrix.getColAggregates(2), { count: 1, sum: 10, min: 10, max: 10 });
+            assert.deepEqual(matrix.getRowAggregates(2), { count: 2, sum: 13, min: 3, max: 10 });
+        });
+
+        it("maintains aggregates across point writes", () => {
+            // Prime the memoized entries, then write through them.
+            matrix.getColAggregates(0);
+            matrix.getRowAggregates(1);
+
+            matrix.setCell(1, 0, 20);       // Overwrite 2 with 20.
+            assert.deepEqual(matrix.getColAggregates(0), { count: 4, sum: 28, min: 1, max: 20 });
+            assert.deepEqual(matrix.getRowAggregates(1), { count: 1, sum: 20, min: 20, max: 20 });
+
+            matrix.setCell(1, 0, undefined);    // Clear the cell (removes the current max).
+            assert.deepEqual(matrix.getColAggregates(0), { count: 3, sum: 8, min: 1, max: 4 });
+        });
+
+        it("reflects row/col insertion and removal", () => {
+            matrix.getColAggregates(0);
+
+            matrix.removeRows(0, 1);    // Drops the cell containing 1.
+            assert.deepEqual(matrix.getColAggregates(0), { count: 3, sum: 9, min: 2, max: 4 });
+
+            matrix.insertRows(0, 1);
+            matrix.setCell(0, 0, 7);
+            assert.deepEqual(matrix.getColAggregates(0), { count: 4, sum: 16, min: 2, max: 7 });
+        });
+
+        it("tracks remote writes", () => {
+            const runtimeFactory = new MockContainerRuntimeFactory();
+            const matrix1 = createConnectedMatrix("matrix1", runtimeFactory);
+            const matrix2 = createConnectedMatrix("matrix2", runtimeFactory);
+
+            matrix1.insertRows(0, 2);
+            matrix1.insertCols(0, 2);
+            runtimeFactory.processAllMessages();
+
+            matrix1.setCell(0, 0, 5);
+            matrix1.setCell(1, 0, 6);
+            runtimeFactory.processAllMessages();
+
+            // Prime matrix2's cache, then deliver a remote overwrite through it.
+            assert.deepEqual(matrix2.getColAggregates(0), { count: 2, sum: 11, min: 5, max: 6 });
+            matrix1.setCell(1, 0, 1);
+            runtimeFactory.processAllMessages();
+            assert.deepEqual(matrix2.getColAggregates(0), { count: 2, sum: 6, min: 1, max: 5 });
+        });
+    });
+});
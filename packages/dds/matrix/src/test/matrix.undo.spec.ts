@@ -102,6 +102,66 @@ describe("Matrix", () => {
                 expectSize(matrix1, /* rowCount */ 0, /* colCount: */ 1);
             });
 
+            it("undo removeRow with handle cache populated past the removed range", async () => {
+                matrix1.insertRows(/* start: */ 0, /* count: */ 3);
+                matrix1.insertCols(/* start: */ 0, /* count: */ 2);
+                matrix1.setCells(/* row: */ 0, /* col: */ 0, /* colCount: */ 2, [
+                    0, 1,
+                    2, 3,
+                    4, 5,
+                ]);
+                undo1.closeCurrentOperation();
+
+                matrix1.removeRows(/* rowStart: */ 1, /* rowCount: */ 1);
+                undo1.closeCurrentOperation();
+
+                // Read a cell beyond the removed range so the handle cache holds entries that
+                // the undo below must invalidate when it transfers handles onto the reinserted
+                // segment.
+                assert.equal(matrix1.getCell(/* row: */ 1, /* col: */ 0), 4);
+
+                undo1.undoOperation();
+
+                // Both the restored cells and the cells after them must read correctly through
+                // the handle cache.
+                assert.equal(matrix1.getCell(/* row: */ 1, /* col: */ 0), 2);
+                assert.equal(matrix1.getCell(/* row: */ 2, /* col: */ 0), 4);
+                await expect([
+                    [0, 1],
+                    [2, 3],
+                    [4, 5],
+                ]);
+            });
+
+            it("undo removeCol with handle cache populated past the removed range", async () => {
+                matrix1.insertRows(/* start: */ 0, /* count: */ 2);
+                matrix1.insertCols(/* start: */ 0, /* count: */ 3);
+                matrix1.setCells(/* row: */ 0, /* col: */ 0, /* colCount: */ 3, [
+                    0, 1, 2,
+                    3, 4, 5,
+                ]);
+                undo1.closeCurrentOperation();
+
+                matrix1.removeCols(/* colStart: */ 1, /* colCount: */ 1);
+                undo1.closeCurrentOperation();
+
+                // Read a cell beyond the removed range so the handle cache holds entries that
+                // the undo below must invalidate when it transfers handles onto the reinserted
+                // segment.
+                assert.equal(matrix1.getCell(/* row: */ 0, /* col: */ 1), 2);
+
+                undo1.undoOperation();
+
+                // Both the restored cells and the cells after them must read correctly through
+                // the handle cache.
+                assert.equal(matrix1.getCell(/* row: */ 0, /* col: */ 1), 1);
+                assert.equal(matrix1.getCell(/* row: */ 0, /* col: */ 2), 2);
+                await expect([
+                    [0, 1, 2],
+                    [3, 4, 5],
+                ]);
+            });
+
             it("undo/redo removeRow 0 of 2x2", async () => {
                 matrix1.insertRows(/* start: */ 0, /* count: */ 2);
                 matrix1.insertCols(/* start: */ 0, /* count: */ 2);
@@ -0,0 +1,97 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { MockFluidDataStoreRuntime, MockLogger } from "@fluidframework/test-runtime-utils";
+import { Handle, isHandleValid } from "../handletable";
+import { PermutationVector } from "../permutationvector";
+
+describe("PermutationVector", () => {
+    let vector: PermutationVector;
+
+    beforeEach(() => {
+        vector = new PermutationVector(
+            "test",
+            new MockLogger(),
+            new MockFluidDataStoreRuntime(),
+            /* deltaCallback: */ () => {},
+            /* handlesRecycledCallback: */ () => {},
+        );
+    });
+
+    /** Asserts that 'getHandleRange()' agrees with per-position 'getMaybeHandle()'. */
+    function assertRangeMatches(start: number, end: number) {
+        const handles = vector.getHandleRange(start, end);
+        assert.equal(handles.length, end - start);
+        for (let pos = start; pos < end; pos++) {
+            assert.equal(handles[pos - start], vector.getMaybeHandle(pos),
+                `Handle mismatch at position ${pos}`);
+        }
+    }
+
+    describe("getHandleRange", () => {
+        it("returns Handle.unallocated for unallocated positions", () => {
+            vector.insert(0, 4);
+            const handles = vector.getHandleRange(0, 4);
+            for (const handle of handles) {
+                assert.equal(handle, Handle.unallocated);
+            }
+        });
+
+        it("matches per-position lookups across allocated and unallocated segments", () => {
+            vector.insert(0, 8);
+            vector.getAllocatedHandle(1);
+            vector.getAllocatedHandle(4);
+            vector.getAllocatedHandle(5);
+            assertRangeMatches(0, 8);
+            assertRangeMatches(3, 6);
+        });
+
+        it("fills a caller-provided typed array", () => {
+            vector.insert(0, 4);
+            vector.getAllocatedHandle(2);
+            const handles = new Int32Array(4);
+            const result = vector.getHandleRange(0, 4, handles);
+            assert.equal(result, handles);
+            assert(isHandleValid(handles[2]));
+        });
+
+        it("throws a RangeError for out-of-bounds ranges", () => {
+            vector.insert(0, 4);
+            assert.throws(() => vector.getHandleRange(0, 5), RangeError);
+            assert.throws(() => vector.getHandleRange(-1, 2), RangeError);
+        });
+    });
+
+    describe("handleCache invalidation", () => {
+        it("preserves cached handles after an insertion shifts them", () => {
+            vector.insert(0, 4);
+            const before = [0, 1, 2, 3].map((pos) => vector.getAllocatedHandle(pos));
+
+            vector.insert(2, 3);
+
+            assert.equal(vector.getMaybeHandle(0), before[0]);
+            assert.equal(vector.getMaybeHandle(1), before[1]);
+            for (let pos = 2; pos < 5; pos++) {
+                assert(!isHandleValid(vector.getMaybeHandle(pos)), "inserted positions should be unallocated");
+            }
+            assert.equal(vector.getMaybeHandle(5), before[2]);
+            assert.equal(vector.getMaybeHandle(6), before[3]);
+            assertRangeMatches(0, vector.getLength());
+        });
+
+        it("preserves cached handles after a removal shifts them", () => {
+            vector.insert(0, 6);
+            const before = [0, 1, 2, 3, 4, 5].map((pos) => vector.getAllocatedHandle(pos));
+
+            vector.remove(1, 3);
+
+            assert.equal(vector.getMaybeHandle(0), before[0]);
+            assert.equal(vector.getMaybeHandle(1), before[4]);
+            assert.equal(vector.getMaybeHandle(2), before[5]);
+            assertRangeMatches(0, vector.getLength());
+        });
+    });
+});
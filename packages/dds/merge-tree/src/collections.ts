@@ -449,6 +449,30 @@ export class RedBlackTree<TKey, TData> implements Base.SortedDictionary<TKey, TD
         return results;
     }
 
+    gatherEach(key: TKey, matcher: IRBMatcher<TKey, TData>, action: (node: RBNode<TKey, TData>) => void) {
+        if (key !== undefined) {
+            this.nodeGatherEach(this.root, key, matcher, action);
+        }
+    }
+
+    nodeGatherEach(
+        node: RBNode<TKey, TData> | undefined,
+        key: TKey,
+        matcher: IRBMatcher<TKey, TData>,
+        action: (node: RBNode<TKey, TData>) => void) {
+        if (node) {
+            if (matcher.continueSubtree(node.left, key)) {
+                this.nodeGatherEach(node.left, key, matcher, action);
+            }
+            if (matcher.matchNode(node, key)) {
+                action(node);
+            }
+            if (matcher.continueSubtree(node.right, key)) {
+                this.nodeGatherEach(node.right, key, matcher, action);
+            }
+        }
+    }
+
     nodeGather(
         node: RBNode<TKey, TData> | undefined,
         results: RBNode<TKey, TData>[],
@@ -1241,6 +1265,11 @@ export class IntervalTree<T extends IInterval> implements IRBAugmentation<T, Aug
         return this.intervals.gather(x, this);
     }
 
+    // Like match(), but calls fn on each overlapping interval instead of allocating an array of nodes.
+    mapMatches(x: T, fn: (x: T) => void) {
+        this.intervals.gatherEach(x, this, (node) => fn(node.key));
+    }
+
     matchNode(node: IntervalNode<T> | undefined, key: T) {
         return !!node && node.key.overlaps(key);
     }
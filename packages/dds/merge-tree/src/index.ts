@@ -14,6 +14,7 @@ export * from "./client";
 export * from "./segmentGroupCollection";
 export * from "./mergeTreeDeltaCallback";
 export * from "./opBuilder";
+export * from "./pool";
 export * from "./mergeTreeTracking";
 export * from "./segmentPropertiesManager";
 export * from "./sortedSegmentSet";
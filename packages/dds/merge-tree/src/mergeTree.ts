@@ -27,6 +27,7 @@ import {
 import { TrackingGroupCollection } from "./mergeTreeTracking";
 import * as ops from "./ops";
 import { PartialSequenceLengths } from "./partialLengths";
+import { ObjectPool } from "./pool";
 import * as Properties from "./properties";
 import { SegmentGroupCollection } from "./segmentGroupCollection";
 import { SegmentPropertiesManager } from "./segmentPropertiesManager";
@@ -62,6 +63,10 @@ export type IMergeNode = IMergeBlock | ISegment;
 // Node with segments as children
 export interface IMergeBlock extends IMergeNodeCommon {
     needsScour?: boolean;
+    // Set whenever the block (or a descendant) is updated, and cleared when the
+    // block's extraction is recorded in the snapshot block cache.  Used by
+    // SnapshotV1 to reuse extractions of unchanged subtrees across summaries.
+    summaryDirty?: boolean;
     childCount: number;
     children: IMergeNode[];
     partialLengths?: PartialSequenceLengths;
@@ -84,6 +89,16 @@ export interface IRemovalInfo {
     removedClientOverlap?: number[];
 }
 
+/**
+ * Cached extraction of a block's segments recorded by a previous snapshot.  Entries are only
+ * recorded for blocks whose segments are all below the minimum sequence number, so the cached
+ * specs stay valid for any later minSeq until the block is updated again (see `summaryDirty`).
+ */
+export interface SnapshotBlockCacheEntry {
+    specs: ops.IJSONSegment[];
+    lengths: number[];
+}
+
 export interface ISegment extends IMergeNodeCommon, IRemovalInfo {
     readonly type: string;
     readonly segmentGroups: SegmentGroupCollection;
@@ -1022,6 +1037,44 @@ const minListenerComparer: Collections.Comparer<MinListener> = {
 export type LocalReferenceMapper = (id: string) => LocalReference;
 
 // Represents a sequence of text segments
+/**
+ * A reusable cursor for merge tree position lookups. The cursor caches the path of blocks walked by its last
+ * lookup, and the next lookup restarts from the deepest cached block that still contains the requested position.
+ * Runs of nearby lookups (typing, rendering a viewport) therefore walk only a block or two instead of the whole
+ * tree, and steady-state lookups allocate nothing - results are written to the segment and offset fields.
+ *
+ * The cached path is discarded automatically whenever the tree's structure or node lengths change, or when a
+ * lookup uses a different (refSeq, clientId) perspective than the previous one.
+ *
+ * Create instances via MergeTree.createSegmentCursor.
+ */
+export class MergeTreeSegmentCursor {
+    /** The segment containing the position of the last moveTo call, or undefined if none contained it. */
+    public segment: ISegment | undefined;
+    /** The offset of the last moveTo position within segment, or undefined if no segment contained it. */
+    public offset: number | undefined;
+
+    // Cached walk state, maintained by MergeTree.moveCursorTo - parallel arrays of the blocks walked by the
+    // last lookup and the tree position at which each starts, plus the tree version and perspective at which
+    // the path was recorded. Do not modify.
+    public readonly cachedBlocks: IMergeBlock[] = [];
+    public readonly cachedBlockPositions: number[] = [];
+    public cachedDepth = 0;
+    public cachedVersion = -1;
+    public cachedRefSeq = -1;
+    public cachedClientId = -1;
+
+    constructor(private readonly mergeTree: MergeTree) {}
+
+    /**
+     * Moves the cursor to the segment containing the given position, as seen from the given perspective.
+     * Returns true if a containing segment was found.
+     */
+    public moveTo(pos: number, refSeq: number, clientId: number): boolean {
+        return this.mergeTree.moveCursorTo(this, pos, refSeq, clientId);
+    }
+}
+
 export class MergeTree {
     // Maximum length of text segment to be considered to be merged with other segment.
     // Maximum segment length is at least 2x of it (not taking into account initial segment creation).
@@ -1065,6 +1118,9 @@ export class MergeTree {
     root: IMergeBlock;
     blockUpdateActions: BlockUpdateActions;
     collabWindow = new CollaborationWindow();
+    // Incremented whenever tree structure or node lengths change. Used to invalidate the cached walk state of
+    // any MergeTreeSegmentCursor handed out by this tree.
+    structureVersion = 0;
     pendingSegments: Collections.List<SegmentGroup> | undefined;
     segmentsToScour: Collections.Heap<LRUSegment> | undefined;
     // TODO: change this to ES6 map; add remove on segment remove
@@ -1072,15 +1128,28 @@ export class MergeTree {
     // if we need to have pointers to non-markers, we can change to point at local refs
     idToSegment = Properties.createMap<ISegment>();
     minSeqListeners: Collections.Heap<MinListener> | undefined;
+    // Lazily created by SnapshotV1 when incremental summaries are enabled.
+    snapshotBlockCache: WeakMap<IMergeBlock, SnapshotBlockCacheEntry> | undefined;
     // For diagnostics
     getLongClientId?: (id: number) => string;
     mergeTreeDeltaCallback?: MergeTreeDeltaCallback;
     mergeTreeMaintenanceCallback?: MergeTreeMaintenanceCallback;
 
+    // Pool of segment groups. One group is allocated per submitted op and released once the
+    // op is acked, so steady-state typing reuses a handful of groups instead of allocating
+    // per keystroke. Opt-in via the "mergeTreeUseObjectPooling" runtime option, since it
+    // changes the lifecycle contract: a group must not be retained past its ack.
+    private readonly segmentGroupPool: ObjectPool<SegmentGroup> | undefined;
+
     // TODO: make and use interface describing options
     constructor(public options?: Properties.PropertySet) {
         this.blockUpdateActions = MergeTree.initBlockUpdateActions;
         this.root = this.makeBlock(0);
+        if (options?.mergeTreeUseObjectPooling === true) {
+            this.segmentGroupPool = new ObjectPool<SegmentGroup>(
+                () => ({ segments: [], localSeq: 0 }),
+                (group) => { group.segments.length = 0; });
+        }
     }
 
     private makeBlock(childCount: number) {
@@ -1392,6 +1461,24 @@ export class MergeTree {
                 // that have recently been scoured
                 block.needsScour = false;
 
+                // Find the held segment that becomes collectible soonest, so the block can be
+                // re-queued at that sequence number.  Without this, a segment whose removal is
+                // still above the minSeq is only revisited if a later op happens to touch its
+                // block again, which lets tombstones accumulate in long-lived documents.
+                let requeueSegment: ISegment | undefined;
+                let requeueSeq = Number.POSITIVE_INFINITY;
+                for (const childNode of childrenCopy) {
+                    if (childNode.isLeaf() && childNode.segmentGroups.empty) {
+                        const collectibleSeq = childNode.removedSeq ?? childNode.seq!;
+                        if (collectibleSeq !== UnassignedSequenceNumber
+                            && collectibleSeq > this.collabWindow.minSeq
+                            && collectibleSeq < requeueSeq) {
+                            requeueSeq = collectibleSeq;
+                            requeueSegment = childNode;
+                        }
+                    }
+                }
+
                 const newChildCount = childrenCopy.length;
 
                 if (newChildCount < block.childCount) {
@@ -1417,6 +1504,15 @@ export class MergeTree {
                         this.blockUpdatePathLengths(block, UnassignedSequenceNumber, -1, true);
                     }
                 }
+
+                // Re-queue the block (or, after a pack, the segment's new block) at the next
+                // collectible sequence number found above.  The heap entry is popped when the
+                // minSeq reaches it, so advancing the window visits exactly the blocks that
+                // gained collectible segments.
+                if (requeueSegment !== undefined && requeueSegment.parent !== undefined) {
+                    requeueSegment.parent.needsScour = true;
+                    this.segmentsToScour!.add({ segment: requeueSegment, maxSeq: requeueSeq });
+                }
             }
         }
 
@@ -1578,15 +1674,112 @@ export class MergeTree {
         let segment: T | undefined;
         let offset: number | undefined;
 
-        const leaf = (leafSeg: ISegment, segpos: number, refSeq: number, clientId: number, start: number) => {
-            segment = leafSeg as T;
-            offset = start;
-            return false;
-        };
-        this.searchBlock(this.root, pos, 0, refSeq, clientId, { leaf }, undefined);
+        // Walk iteratively rather than through searchBlock so that position lookups - the hottest merge tree
+        // query - allocate no actions object or leaf closure.
+        let _pos = pos;
+        let block: IMergeBlock | undefined = this.root;
+        while (block !== undefined) {
+            const children = block.children;
+            let nextBlock: IMergeBlock | undefined;
+            for (let childIndex = 0; childIndex < block.childCount; childIndex++) {
+                const child = children[childIndex];
+                const len = this.nodeLength(child, refSeq, clientId) ?? 0;
+                if (_pos < len) {
+                    // Found entry containing pos
+                    if (child.isLeaf()) {
+                        segment = child as T;
+                        offset = _pos;
+                    } else {
+                        nextBlock = child;
+                    }
+                    break;
+                }
+                _pos -= len;
+            }
+            block = segment === undefined ? nextBlock : undefined;
+        }
         return { segment, offset };
     }
 
+    /**
+     * Creates a reusable cursor for position lookups over this tree. See MergeTreeSegmentCursor.
+     */
+    createSegmentCursor(): MergeTreeSegmentCursor {
+        return new MergeTreeSegmentCursor(this);
+    }
+
+    /**
+     * Moves the given cursor to the segment containing pos. The walk restarts from the deepest block cached by
+     * the cursor's previous lookup that still contains pos, falling back to the root when the tree or the lookup
+     * perspective changed since then. Returns true if a containing segment was found; the result is written to
+     * the cursor's segment and offset fields.
+     */
+    moveCursorTo(cursor: MergeTreeSegmentCursor, pos: number, refSeq: number, clientId: number): boolean {
+        // Discard the cached path if the tree changed since it was recorded or if it was recorded from a
+        // different perspective - node lengths depend on (refSeq, clientId).
+        if (cursor.cachedVersion !== this.structureVersion ||
+            cursor.cachedRefSeq !== refSeq ||
+            cursor.cachedClientId !== clientId) {
+            cursor.cachedBlocks.length = 0;
+            cursor.cachedBlockPositions.length = 0;
+            cursor.cachedDepth = 0;
+            cursor.cachedVersion = this.structureVersion;
+            cursor.cachedRefSeq = refSeq;
+            cursor.cachedClientId = clientId;
+        }
+
+        // Restart from the deepest cached block that still contains the position. For runs of nearby lookups
+        // this is the last walked block (or a close ancestor), making sequential access near O(1) amortized.
+        let block: IMergeBlock = this.root;
+        let blockStart = 0;
+        while (cursor.cachedDepth > 0) {
+            const depth = cursor.cachedDepth - 1;
+            const cachedBlock = cursor.cachedBlocks[depth];
+            const cachedStart = cursor.cachedBlockPositions[depth];
+            const len = this.nodeLength(cachedBlock, refSeq, clientId) ?? 0;
+            if (pos >= cachedStart && pos < cachedStart + len) {
+                block = cachedBlock;
+                blockStart = cachedStart;
+                // Pop the matched block - the descent below re-records it.
+                cursor.cachedDepth = depth;
+                break;
+            }
+            cursor.cachedDepth--;
+        }
+
+        let _pos = pos - blockStart;
+        let curBlock: IMergeBlock | undefined = block;
+        while (curBlock !== undefined) {
+            cursor.cachedBlocks[cursor.cachedDepth] = curBlock;
+            cursor.cachedBlockPositions[cursor.cachedDepth] = blockStart;
+            cursor.cachedDepth++;
+
+            const children = curBlock.children;
+            let nextBlock: IMergeBlock | undefined;
+            for (let childIndex = 0; childIndex < curBlock.childCount; childIndex++) {
+                const child = children[childIndex];
+                const len = this.nodeLength(child, refSeq, clientId) ?? 0;
+                if (_pos < len) {
+                    // Found entry containing pos
+                    if (child.isLeaf()) {
+                        cursor.segment = child;
+                        cursor.offset = _pos;
+                        return true;
+                    }
+                    nextBlock = child;
+                    break;
+                }
+                _pos -= len;
+                blockStart += len;
+            }
+            curBlock = nextBlock;
+        }
+
+        cursor.segment = undefined;
+        cursor.offset = undefined;
+        return false;
+    }
+
     private blockLength(node: IMergeBlock, refSeq: number, clientId: number) {
         if ((this.collabWindow.collaborating) && (clientId !== this.collabWindow.clientId)) {
             return node.partialLengths!.getPartialLength(refSeq, clientId);
@@ -1678,7 +1871,12 @@ export class MergeTree {
         if (minSeq > this.collabWindow.minSeq) {
             this.collabWindow.minSeq = minSeq;
             if (MergeTree.options.zamboniSegments) {
-                this.zamboniSegments();
+                // Advancing the minSeq is what makes queued segments collectible, so drain
+                // everything at or below the new minSeq here.  The scour heap is keyed by the
+                // sequence number at which a segment becomes collectible, so this visits only
+                // the blocks that actually gained collectible segments and keeps segment
+                // count bounded without relying on the per-op scour cap.
+                this.zamboniSegments(Number.POSITIVE_INFINITY);
             }
             this.notifyMinSeqListeners();
         }
@@ -1877,6 +2075,10 @@ export class MergeTree {
                 this.blockUpdatePathLengths(node, seq, clientId, overwrite);
                 // NodeUpdatePathLengths(node, seq, clientId, true);
             }
+
+            // The group has been dequeued from the pending list and from every segment's
+            // collection; nothing reaches it past this point, so it can back the next op.
+            this.segmentGroupPool?.release(pendingSegmentGroup);
         }
         if (MergeTree.options.zamboniSegments) {
             this.zamboniSegments();
@@ -1886,8 +2088,14 @@ export class MergeTree {
     private addToPendingList(segment: ISegment, segmentGroup?: SegmentGroup, localSeq?: number) {
         let _segmentGroup = segmentGroup;
         if (_segmentGroup === undefined) {
-            // TODO: review the cast
-            _segmentGroup = { segments: [], localSeq } as SegmentGroup;
+            if (this.segmentGroupPool !== undefined) {
+                _segmentGroup = this.segmentGroupPool.get();
+                // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+                _segmentGroup.localSeq = localSeq!;
+            } else {
+                // TODO: review the cast
+                _segmentGroup = { segments: [], localSeq } as SegmentGroup;
+            }
             this.pendingSegments!.enqueue(_segmentGroup);
         }
         segment.segmentGroups.enqueue(_segmentGroup);
@@ -2550,6 +2758,9 @@ export class MergeTree {
 
         const annotateSegment = (segment: ISegment) => {
             const propertyDeltas = segment.addProperties(props, combiningOp, seq, this.collabWindow);
+            // Annotate does not change lengths, so the blockUpdate path is not run here.
+            // Mark the path explicitly so cached snapshot extractions are not reused.
+            this.blockMarkSummaryDirty(segment.parent);
             deltaSegments.push({ segment, propertyDeltas });
             if (this.collabWindow.collaborating) {
                 if (seq === UnassignedSequenceNumber) {
@@ -2693,6 +2904,7 @@ export class MergeTree {
     }
 
     private nodeUpdateLengthNewStructure(node: IMergeBlock, recur = false) {
+        this.structureVersion++;
         this.blockUpdate(node);
         if (this.collabWindow.collaborating) {
             node.partialLengths = PartialSequenceLengths.combine(this, node, this.collabWindow, recur);
@@ -2721,7 +2933,19 @@ export class MergeTree {
             LocalClientId);
     }
 
+    // Marks the path from the given block to the root as changed for snapshot purposes.
+    // Only needed on paths (e.g. annotate) that change segment content without updating lengths;
+    // all other mutations mark the path via `blockUpdate`.
+    private blockMarkSummaryDirty(startBlock: IMergeBlock | undefined) {
+        let block: IMergeBlock | undefined = startBlock;
+        while (block !== undefined) {
+            block.summaryDirty = true;
+            block = block.parent;
+        }
+    }
+
     private blockUpdate(block: IMergeBlock) {
+        block.summaryDirty = true;
         let len = 0;
         const hierBlock = block.hierBlock();
         if (hierBlock) {
@@ -2743,6 +2967,7 @@ export class MergeTree {
     }
 
     private blockUpdatePathLengths(startBlock: IMergeBlock | undefined, seq: number, clientId: number, newStructure = false) {
+        this.structureVersion++;
         let block: IMergeBlock | undefined = startBlock;
         while (block !== undefined) {
             if (newStructure) {
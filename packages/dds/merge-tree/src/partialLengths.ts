@@ -54,6 +54,81 @@ export interface PartialSequenceLength {
     overlapRemoveClients?: RedBlackTree<number, IOverlapClient>;
 }
 
+/**
+ * Packed structure-of-arrays mirror of a PartialSequenceLength list.  Only the (seq, len)
+ * columns are needed on the query path, so queries binary search a pair of typed arrays
+ * instead of chasing one object per entry.  `count` is the number of valid entries; the
+ * arrays may hold extra capacity so the tail can be updated in place as new sequence
+ * numbers arrive.
+ */
+interface IPackedPartialLengths {
+    seqs: Int32Array;
+    lens: Float64Array;
+    count: number;
+}
+
+function packPartialLengths(partialLengths: PartialSequenceLength[]): IPackedPartialLengths {
+    const count = partialLengths.length;
+    const capacity = Math.max(count * 2, 8);
+    const seqs = new Int32Array(capacity);
+    const lens = new Float64Array(capacity);
+    for (let i = 0; i < count; i++) {
+        seqs[i] = partialLengths[i].seq;
+        lens[i] = partialLengths[i].len;
+    }
+    return { seqs, lens, count };
+}
+
+/**
+ * Packed equivalent of `latestLEQ`: index of the entry with the greatest sequence number
+ * less than or equal to key, or -1.
+ */
+function latestLEQPacked(packed: IPackedPartialLengths, key: number) {
+    let best = -1;
+    let lo = 0;
+    let hi = packed.count - 1;
+    const seqs = packed.seqs;
+    while (lo <= hi) {
+        const mid = lo + Math.floor((hi - lo) / 2);
+        if (seqs[mid] <= key) {
+            best = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return best;
+}
+
+/**
+ * Brings a packed mirror up to date after `update` appended or modified the final entry of
+ * the source list.  Returns false if the lists have diverged by more than the tail entry,
+ * in which case the caller must discard the mirror and repack.
+ */
+function syncPackedTail(packed: IPackedPartialLengths, partialLengths: PartialSequenceLength[]): boolean {
+    const count = partialLengths.length;
+    if (count === 0) {
+        return packed.count === 0;
+    }
+    if (packed.count === count - 1) {
+        if (count > packed.seqs.length) {
+            const seqs = new Int32Array(packed.seqs.length * 2);
+            const lens = new Float64Array(packed.lens.length * 2);
+            seqs.set(packed.seqs);
+            lens.set(packed.lens);
+            packed.seqs = seqs;
+            packed.lens = lens;
+        }
+        packed.count = count;
+    } else if (packed.count !== count) {
+        return false;
+    }
+    const entry = partialLengths[count - 1];
+    packed.seqs[count - 1] = entry.seq;
+    packed.lens[count - 1] = entry.len;
+    return true;
+}
+
 /**
  * Keep track of partial sums of segment lengths for all sequence numbers
  * in the current collaboration window (if any).  Only used during active
@@ -69,6 +144,11 @@ export class PartialSequenceLengths {
         return PartialSequenceLengths.combineBranch(mergeTree, block, collabWindow, recur);
     }
 
+    // TODO: Make the packed layout the default once it has soaked.
+    private static usePacked(mergeTree: MergeTree) {
+        return mergeTree.options?.mergeTreeUsePackedPartialLengths === true;
+    }
+
     /**
      * Combine the partial lengths of block's children
      * @param block - an interior node; it is assumed that each interior node child of this block
@@ -80,7 +160,7 @@ export class PartialSequenceLengths {
         block: IMergeBlock,
         collabWindow: CollaborationWindow,
         recur = false) {
-        let combinedPartialLengths = new PartialSequenceLengths(collabWindow.minSeq);
+        let combinedPartialLengths = new PartialSequenceLengths(collabWindow.minSeq, PartialSequenceLengths.usePacked(mergeTree));
         PartialSequenceLengths.fromLeaves(mergeTree, combinedPartialLengths, block, collabWindow);
         let prevPartial: PartialSequenceLength | undefined;
 
@@ -159,7 +239,7 @@ export class PartialSequenceLengths {
                 // Some children were leaves; add combined partials from these segments
                 childPartials.push(combinedPartialLengths);
                 childPartialsLen++;
-                combinedPartialLengths = new PartialSequenceLengths(collabWindow.minSeq);
+                combinedPartialLengths = new PartialSequenceLengths(collabWindow.minSeq, PartialSequenceLengths.usePacked(mergeTree));
             }
             const indices = new Array<number>(childPartialsLen);
             const childPartialsCounts = new Array<number>(childPartialsLen);
@@ -392,8 +472,12 @@ export class PartialSequenceLengths {
     public segmentCount = 0;
     public partialLengths: PartialSequenceLength[] = [];
     public clientSeqNumbers: PartialSequenceLength[][] = [];
+    // Packed mirrors of the above, built lazily on first query when the packed layout is
+    // enabled.  `update` keeps them in sync in place; zamboni discards them.
+    private packed: IPackedPartialLengths | undefined;
+    private packedCli: (IPackedPartialLengths | undefined)[] = [];
 
-    constructor(public minSeq: number) {
+    constructor(public minSeq: number, private readonly usePackedLengths = false) {
     }
 
     // Assume: seq is latest sequence number; no structural change to sub-tree, but a segment
@@ -446,6 +530,16 @@ export class PartialSequenceLengths {
             this.clientSeqNumbers[clientId] = [];
         }
         PartialSequenceLengths.addSeq(this.clientSeqNumbers[clientId], seq, seqSeglen);
+
+        // `addSeq` only ever appends or modifies the entry for the latest sequence number,
+        // so existing packed mirrors can be brought up to date in place.
+        if (this.packed !== undefined && !syncPackedTail(this.packed, this.partialLengths)) {
+            this.packed = undefined;
+        }
+        const cliPacked = this.packedCli[clientId];
+        if (cliPacked !== undefined && !syncPackedTail(cliPacked, this.clientSeqNumbers[clientId])) {
+            this.packedCli[clientId] = undefined;
+        }
         //    console.log(this.toString());
         if (PartialSequenceLengths.options.zamboni) {
             this.zamboni(collabWindow);
@@ -458,6 +552,9 @@ export class PartialSequenceLengths {
     }
 
     public getPartialLength(refSeq: number, clientId: number) {
+        if (this.usePackedLengths) {
+            return this.getPartialLengthPacked(refSeq, clientId);
+        }
         let pLen = this.minLength;
         const seqIndex = latestLEQ(this.partialLengths, refSeq);
         const cliLatestindex = this.cliLatest(clientId);
@@ -489,6 +586,41 @@ export class PartialSequenceLengths {
         return pLen;
     }
 
+    // Packed equivalent of the object-walking path above, used when the packed layout is
+    // enabled.  Mirrors are built on first use and kept current by `update`/`zamboni`.
+    private getPartialLengthPacked(refSeq: number, clientId: number) {
+        if (this.packed === undefined) {
+            this.packed = packPartialLengths(this.partialLengths);
+        }
+        let cli = this.packedCli[clientId];
+        if (cli === undefined && this.clientSeqNumbers[clientId] !== undefined) {
+            cli = this.packedCli[clientId] = packPartialLengths(this.clientSeqNumbers[clientId]);
+        }
+
+        let pLen = this.minLength;
+        const seqIndex = latestLEQPacked(this.packed, refSeq);
+        if (seqIndex >= 0) {
+            // Add the partial length up to refSeq
+            pLen += this.packed.lens[seqIndex];
+
+            if (cli !== undefined && cli.count > 0 && cli.seqs[cli.count - 1] > refSeq) {
+                // The client has local edits after refSeq, add in the length adjustments
+                pLen += cli.lens[cli.count - 1];
+                const precedingCliIndex = latestLEQPacked(cli, refSeq);
+                if (precedingCliIndex >= 0) {
+                    pLen -= cli.lens[precedingCliIndex];
+                }
+            }
+        } else {
+            // RefSeq is before any of the partial lengths
+            // so just add in all local edits of that client (which should all be after the refSeq)
+            if (cli !== undefined && cli.count > 0) {
+                pLen += cli.lens[cli.count - 1];
+            }
+        }
+        return pLen;
+    }
+
     public toString(glc?: (id: number) => string, indentCount = 0) {
         let buf = "";
         for (const partial of this.partialLengths) {
@@ -517,11 +649,13 @@ export class PartialSequenceLengths {
 
     // Clear away partial sums for sequence numbers earlier than the current window
     private zamboni(segmentWindow: CollaborationWindow) {
+        let copiedDown = false;
         function copyDown(partialLengths: PartialSequenceLength[]) {
             const mindex = latestLEQ(partialLengths, segmentWindow.minSeq);
             let minLength = 0;
             // console.log(`mindex ${mindex}`);
             if (mindex >= 0) {
+                copiedDown = true;
                 minLength = partialLengths[mindex].len;
                 const seqCount = partialLengths.length;
                 if (mindex <= (seqCount - 1)) {
@@ -545,6 +679,12 @@ export class PartialSequenceLengths {
                 copyDown(cliPartials);
             }
         }
+        if (copiedDown) {
+            // Copy down rewrites entries wholesale; discard any packed mirrors and let the
+            // next query repack.
+            this.packed = undefined;
+            this.packedCli = [];
+        }
     }
 
     private addClientSeqNumber(clientId: number, seq: number, seglen: number) {
@@ -0,0 +1,35 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+/**
+ * A bounded freelist of reusable objects for high-churn allocation sites (e.g. one object
+ * per submitted op), so steady-state typing reuses a handful of objects instead of feeding
+ * the minor GC.
+ *
+ * Callers own the lifecycle contract: an object must not be released while anything can
+ * still reach it, since it will be handed out again by the next 'get()'.
+ */
+export class ObjectPool<T> {
+    private readonly freeList: T[] = [];
+
+    constructor(
+        private readonly allocate: () => T,
+        private readonly reset: (value: T) => void,
+        private readonly capacity: number = 64,
+    ) {}
+
+    public get(): T {
+        return this.freeList.pop() ?? this.allocate();
+    }
+
+    public release(value: T): void {
+        // Once at capacity just drop the object; an unbounded freelist would pin the high
+        // watermark of a burst forever.
+        if (this.freeList.length < this.capacity) {
+            this.reset(value);
+            this.freeList.push(value);
+        }
+    }
+}
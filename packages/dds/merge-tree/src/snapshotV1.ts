@@ -19,6 +19,7 @@ import {
 import { IChannelStorageService } from "@fluidframework/datastore-definitions";
 import { UnassignedSequenceNumber } from "./constants";
 import * as MergeTree from "./mergeTree";
+import { IJSONSegment } from "./ops";
 import * as Properties from "./properties";
 import {
     IJSONSegmentWithMergeInfo,
@@ -163,8 +164,86 @@ export class SnapshotV1 {
     }
 
     extractSync() {
+        // TODO: Make incremental extraction the default once it has soaked.
+        if (this.mergeTree.options?.mergeTreeUseIncrementalSummaries === true) {
+            return this.extractSyncIncremental();
+        }
+        this.extractSyncBlock(this.mergeTree.root);
+        return this.segments;
+    }
+
+    /**
+     * Incremental variant of `extractSync` that reuses the extraction of subtrees that have not
+     * changed since the previous snapshot.  The tree is partitioned into roughly chunk-sized
+     * blocks; a block whose extraction contained only segments below the MSN (no merge info and
+     * nothing elided) is recorded in the MergeTree's snapshot block cache and replayed on
+     * subsequent snapshots until the block is updated again (see `IMergeBlock.summaryDirty`),
+     * so extraction cost scales with the edit delta rather than the document size.
+     */
+    private extractSyncIncremental(): JsonSegmentSpecs[] {
+        const mergeTree = this.mergeTree;
+        if (mergeTree.snapshotBlockCache === undefined) {
+            mergeTree.snapshotBlockCache = new WeakMap();
+        }
+        const cache = mergeTree.snapshotBlockCache;
+        const chunkBlocks: MergeTree.IMergeBlock[] = [];
+        this.collectChunkBlocks(mergeTree.root, chunkBlocks);
+        for (const block of chunkBlocks) {
+            const cached = block.summaryDirty === false ? cache.get(block) : undefined;
+            if (cached !== undefined) {
+                for (let i = 0; i < cached.specs.length; i++) {
+                    this.segments.push(cached.specs[i]);
+                    this.segmentLengths.push(cached.lengths[i]);
+                }
+                continue;
+            }
+            const startIndex = this.segments.length;
+            if (this.extractSyncBlock(block)) {
+                cache.set(block, {
+                    specs: this.segments.slice(startIndex) as IJSONSegment[],
+                    lengths: this.segmentLengths.slice(startIndex),
+                });
+                block.summaryDirty = false;
+            }
+        }
+        return this.segments;
+    }
+
+    /**
+     * Partitions the tree into the blocks used as units of incremental extraction.  Descends
+     * while a block is longer than a single chunk and all of its children are blocks, so cache
+     * granularity roughly tracks the chunk size.  Note that segments are not coalesced across
+     * the blocks returned here, which may produce slightly more snapshot segments than a full
+     * extraction would.
+     */
+    private collectChunkBlocks(block: MergeTree.IMergeBlock, chunkBlocks: MergeTree.IMergeBlock[]) {
+        if (block.cachedLength > this.chunkSize && block.childCount > 0) {
+            let allBlocks = true;
+            for (let i = 0; i < block.childCount; i++) {
+                if (block.children[i].isLeaf()) {
+                    allBlocks = false;
+                    break;
+                }
+            }
+            if (allBlocks) {
+                for (let i = 0; i < block.childCount; i++) {
+                    this.collectChunkBlocks(block.children[i] as MergeTree.IMergeBlock, chunkBlocks);
+                }
+                return;
+            }
+        }
+        chunkBlocks.push(block);
+    }
+
+    /**
+     * Extracts the segments of the given block's subtree into the snapshot.  Returns true if the
+     * extraction is cacheable for reuse by later snapshots - i.e. every segment produced a plain
+     * spec with no merge info and no segments were elided - and false otherwise.
+     */
+    private extractSyncBlock(block: MergeTree.IMergeBlock): boolean {
         const mergeTree = this.mergeTree;
         const minSeq = this.header.minSequenceNumber;
+        let cacheable = true;
 
         // Helper to add the given `MergeTreeChunkV0SegmentSpec` to the snapshot.
         const pushSegRaw = (json: JsonSegmentSpecs, length: number) => {
@@ -187,6 +266,7 @@ export class SnapshotV1 {
             //      segment, and therefore we can discard it.
             // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
             if (segment.seq === UnassignedSequenceNumber || segment.removedSeq! <= minSeq) {
+                cacheable = false;
                 return true;
             }
 
@@ -217,6 +297,7 @@ export class SnapshotV1 {
             } else {
                 // This segment needs to preserve it's metadata as it may be referenced by future ops.  It's ineligible
                 // for coalescing, so emit the 'prev' segment now (if any).
+                cacheable = false;
                 pushSeg(prev);
                 prev = undefined;
 
@@ -249,12 +330,12 @@ export class SnapshotV1 {
             return true;
         };
 
-        mergeTree.walkAllSegments(mergeTree.root, extractSegment, this);
+        mergeTree.walkAllSegments(block, extractSegment, this);
 
         // If the last segment in the walk was coalescable, push it now.
         pushSeg(prev);
 
-        return this.segments;
+        return cacheable;
     }
 
     public static async loadChunk(
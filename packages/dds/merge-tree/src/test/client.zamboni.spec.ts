@@ -0,0 +1,60 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { ISegment } from "../mergeTree";
+import { TestClient } from "./testClient";
+
+describe("client.zamboni", () => {
+    const localUserLongId = "localUser";
+    let client: TestClient;
+
+    beforeEach(() => {
+        client = new TestClient();
+        for (const c of "abcd") {
+            client.insertTextLocal(client.getLength(), c);
+        }
+        client.startOrUpdateCollaboration(localUserLongId);
+    });
+
+    it("collects tombstones when the minSeq advances past their removal", () => {
+        const segB = client.getContainingSegment(1).segment as ISegment;
+
+        client.applyMsg(
+            client.makeOpMessage(client.removeRangeLocal(1, 2), /* seq */ 1, /* refSeq */ 0, undefined, /* minSeq */ 0));
+        assert.notStrictEqual(segB.parent, undefined);
+
+        // An unrelated op that advances the minSeq past the removal should collect the tombstone.
+        client.applyMsg(
+            client.makeOpMessage(
+                client.insertTextLocal(client.getLength(), "x"), /* seq */ 2, /* refSeq */ 1, undefined, /* minSeq */ 1));
+        assert.strictEqual(segB.parent, undefined);
+    });
+
+    it("collects tombstones held over from an earlier scour of their block", () => {
+        const segB = client.getContainingSegment(1).segment as ISegment;
+        const segC = client.getContainingSegment(2).segment as ISegment;
+
+        client.applyMsg(
+            client.makeOpMessage(client.removeRangeLocal(1, 2), /* seq */ 1, /* refSeq */ 0, undefined, /* minSeq */ 0));
+        client.applyMsg(
+            client.makeOpMessage(client.removeRangeLocal(1, 2), /* seq */ 2, /* refSeq */ 1, undefined, /* minSeq */ 0));
+
+        // Advancing the minSeq to 1 scours the block and collects the first tombstone, but the
+        // second removal is still above the minSeq and must be held.
+        client.applyMsg(
+            client.makeOpMessage(
+                client.insertTextLocal(client.getLength(), "x"), /* seq */ 3, /* refSeq */ 2, undefined, /* minSeq */ 1));
+        assert.strictEqual(segB.parent, undefined);
+        assert.notStrictEqual(segC.parent, undefined);
+
+        // Advancing the minSeq to 2 must revisit the block and collect the held tombstone, even
+        // though no further ops touch it.
+        client.applyMsg(
+            client.makeOpMessage(
+                client.insertTextLocal(client.getLength(), "y"), /* seq */ 4, /* refSeq */ 3, undefined, /* minSeq */ 2));
+        assert.strictEqual(segC.parent, undefined);
+    });
+});
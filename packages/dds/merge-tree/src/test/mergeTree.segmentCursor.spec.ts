@@ -0,0 +1,76 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { MergeTreeSegmentCursor } from "../mergeTree";
+import { TestClient } from "./testClient";
+
+describe("MergeTree.segmentCursor", () => {
+    const localUserLongId = "localUser";
+    let client: TestClient;
+    let cursor: MergeTreeSegmentCursor;
+
+    beforeEach(() => {
+        client = new TestClient();
+        for (const c of "hello world") {
+            client.insertTextLocal(client.getLength(), c);
+        }
+        client.startOrUpdateCollaboration(localUserLongId);
+        cursor = client.mergeTree.createSegmentCursor();
+    });
+
+    function assertCursorMatchesSearch(pos: number) {
+        const found = cursor.moveTo(pos, client.getCurrentSeq(), client.getClientId());
+        const segOff = client.getContainingSegment(pos);
+        assert.strictEqual(found, segOff.segment !== undefined, `Found mismatch at pos ${pos}`);
+        assert.strictEqual(cursor.segment, segOff.segment, `Segment mismatch at pos ${pos}`);
+        assert.strictEqual(cursor.offset, segOff.offset, `Offset mismatch at pos ${pos}`);
+    }
+
+    it("matches getContainingSegment for sequential lookups", () => {
+        for (let pos = 0; pos < client.getLength(); pos++) {
+            assertCursorMatchesSearch(pos);
+        }
+    });
+
+    it("matches getContainingSegment for backward and repeated lookups", () => {
+        for (let pos = client.getLength() - 1; pos >= 0; pos--) {
+            assertCursorMatchesSearch(pos);
+            assertCursorMatchesSearch(pos);
+        }
+    });
+
+    it("returns no segment past the end of the tree", () => {
+        const found = cursor.moveTo(client.getLength(), client.getCurrentSeq(), client.getClientId());
+        assert.strictEqual(found, false, "Should not find a segment past the end");
+        assert.strictEqual(cursor.segment, undefined);
+        assert.strictEqual(cursor.offset, undefined);
+    });
+
+    it("invalidates its cached walk state when the tree changes", () => {
+        assertCursorMatchesSearch(4);
+
+        // Insert before the cached position so that its containing block's start shifts.
+        client.insertTextLocal(0, "prefix ");
+        for (let pos = 0; pos < client.getLength(); pos++) {
+            assertCursorMatchesSearch(pos);
+        }
+
+        // Remove a range and check again.
+        client.removeRangeLocal(2, 9);
+        for (let pos = 0; pos < client.getLength(); pos++) {
+            assertCursorMatchesSearch(pos);
+        }
+    });
+
+    it("invalidates its cached walk state when acked ops move remote perspectives", () => {
+        assertCursorMatchesSearch(4);
+
+        client.applyMsg(client.makeOpMessage(client.insertTextLocal(0, "more text "), 1));
+        for (let pos = 0; pos < client.getLength(); pos++) {
+            assertCursorMatchesSearch(pos);
+        }
+    });
+});
@@ -0,0 +1,55 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { ISequencedDocumentMessage } from "@fluidframework/protocol-definitions";
+import { TestClient } from "./testClient";
+
+describe("partial lengths packed layout", () => {
+    // Applies the same message stream to a client using the packed typed-array layout and one
+    // using the object layout, then compares the lengths both compute for every (refSeq,
+    // client) combination in the collaboration window.
+    it("matches the object layout across interleaved edits", () => {
+        const packed = new TestClient({ mergeTreeUsePackedPartialLengths: true });
+        const plain = new TestClient();
+        const remote = new TestClient();
+        for (const client of [packed, plain, remote]) {
+            client.insertTextLocal(0, "hello world");
+        }
+        packed.startOrUpdateCollaboration("A");
+        plain.startOrUpdateCollaboration("A");
+        remote.startOrUpdateCollaboration("B");
+
+        let seq = 0;
+        let minSeq = 0;
+        const applyToAll = (msg: ISequencedDocumentMessage) => {
+            packed.applyMsg(msg);
+            plain.applyMsg(msg);
+            remote.applyMsg(msg);
+        };
+
+        // Local edits from "A" (the same op is pending on both the packed and plain client).
+        plain.insertTextLocal(5, "!");
+        applyToAll(packed.makeOpMessage(packed.insertTextLocal(5, "!"), ++seq, seq - 1, undefined, minSeq));
+        plain.removeRangeLocal(0, 2);
+        applyToAll(packed.makeOpMessage(packed.removeRangeLocal(0, 2), ++seq, seq - 1, undefined, minSeq));
+
+        // Remote edits from "B", including one that advances the minSeq mid-stream.
+        applyToAll(remote.makeOpMessage(remote.insertTextLocal(0, "yo "), ++seq, seq - 1, undefined, minSeq));
+        minSeq = 2;
+        applyToAll(remote.makeOpMessage(remote.removeRangeLocal(4, 8), ++seq, seq - 1, undefined, minSeq));
+        applyToAll(remote.makeOpMessage(remote.insertTextLocal(remote.getLength(), "tail"), ++seq, seq - 1, undefined, minSeq));
+
+        assert.equal(packed.getText(), plain.getText());
+        for (let refSeq = minSeq; refSeq <= seq; refSeq++) {
+            for (const longClientId of ["A", "B"]) {
+                assert.equal(
+                    packed.mergeTree.getLength(refSeq, packed.getOrAddShortClientId(longClientId)),
+                    plain.mergeTree.getLength(refSeq, plain.getOrAddShortClientId(longClientId)),
+                    `Length mismatch at refSeq ${refSeq} for client ${longClientId}`);
+            }
+        }
+    });
+});
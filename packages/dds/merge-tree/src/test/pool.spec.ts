@@ -0,0 +1,82 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { ObjectPool } from "../pool";
+import { TestClient } from "./testClient";
+
+describe("ObjectPool", () => {
+    it("allocates when empty and reuses released objects", () => {
+        let allocated = 0;
+        const pool = new ObjectPool<number[]>(
+            () => { allocated++; return []; },
+            (value) => { value.length = 0; });
+
+        const first = pool.get();
+        first.push(1, 2, 3);
+        assert.equal(allocated, 1);
+
+        pool.release(first);
+        const second = pool.get();
+        assert.equal(second, first);
+        assert.equal(second.length, 0, "released object should be reset");
+        assert.equal(allocated, 1);
+    });
+
+    it("drops releases beyond capacity", () => {
+        let resets = 0;
+        const pool = new ObjectPool<object>(
+            () => ({}),
+            () => { resets++; },
+            2);
+
+        pool.release({});
+        pool.release({});
+        pool.release({});
+
+        assert.equal(resets, 2, "object released at capacity should be dropped without reset");
+    });
+});
+
+describe("segment group pooling", () => {
+    const localUserLongId = "localUser";
+    let client: TestClient;
+
+    beforeEach(() => {
+        client = new TestClient({ mergeTreeUseObjectPooling: true });
+        client.insertTextLocal(0, "hello world");
+        client.startOrUpdateCollaboration(localUserLongId);
+    });
+
+    it("reuses the segment group of an acked op for the next op", () => {
+        const op1 = client.insertTextLocal(5, " there");
+        const group1 = client.mergeTree.pendingSegments.last();
+        client.applyMsg(client.makeOpMessage(op1, 1));
+        assert.equal(client.mergeTree.pendingSegments.count(), 0);
+
+        const op2 = client.insertTextLocal(0, "oh ");
+        const group2 = client.mergeTree.pendingSegments.last();
+        assert.equal(group2, group1, "acked segment group should be reused");
+        assert.equal(group2.segments.length, 1, "reused segment group should start empty");
+
+        client.applyMsg(client.makeOpMessage(op2, 2, /* refSeq */ 1));
+        assert.equal(client.getText(), "oh hello there world");
+        assert.equal(client.mergeTree.pendingSegments.count(), 0);
+    });
+
+    it("does not pool when the option is not set", () => {
+        const defaultClient = new TestClient();
+        defaultClient.insertTextLocal(0, "hello world");
+        defaultClient.startOrUpdateCollaboration(localUserLongId);
+
+        const op1 = defaultClient.insertTextLocal(5, " there");
+        const group1 = defaultClient.mergeTree.pendingSegments.last();
+        defaultClient.applyMsg(defaultClient.makeOpMessage(op1, 1));
+
+        defaultClient.insertTextLocal(0, "oh ");
+        const group2 = defaultClient.mergeTree.pendingSegments.last();
+        assert.notEqual(group2, group1);
+    });
+});
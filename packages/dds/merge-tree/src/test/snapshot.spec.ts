@@ -8,6 +8,7 @@ import { ISequencedDocumentMessage, ITree } from "@fluidframework/protocol-defin
 import { IFluidDataStoreRuntime } from "@fluidframework/datastore-definitions";
 import { MockStorage } from "@fluidframework/test-runtime-utils";
 import { IMergeTreeOp } from "../ops";
+import { PropertySet } from "../properties";
 import { SnapshotV1 } from "../snapshotV1";
 import { TestSerializer } from "./testSerializer";
 import { TestClient } from ".";
@@ -28,12 +29,13 @@ async function loadSnapshot(tree: ITree) {
 
 // Wrapper around MergeTree client that provides a convenient SharedString-like API for tests.
 class TestString {
-    private client = new TestClient();
+    private client: TestClient;
     private readonly pending: ISequencedDocumentMessage[] = [];
     private seq = 0;
     private minSeq = 0;
 
-    constructor(id: string) {
+    constructor(id: string, options?: PropertySet) {
+        this.client = new TestClient(options);
         this.client.startOrUpdateCollaboration(id);
     }
 
@@ -85,6 +87,8 @@ class TestString {
 
     public getText() { return this.client.getText(); }
 
+    public applyPendingOps() { this.applyPending(); }
+
     private applyPending() {
         for (const msg of this.pending) {
             this.client.applyMsg(msg);
@@ -203,3 +207,49 @@ describe("snapshot", () => {
         await str.checkSnapshot();
     });
 });
+
+describe("incremental snapshot", () => {
+    let str: TestString;
+
+    beforeEach(() => {
+        str = new TestString("fakeId", { mergeTreeUseIncrementalSummaries: true });
+    });
+
+    it("roundtrips a multi-chunk document", async () => {
+        for (let i = 0; i < SnapshotV1.chunkSize + 10; i++) {
+            str.append(`${i % 10}`, /* increaseMsn: */ true);
+        }
+
+        await str.checkSnapshot();
+    });
+
+    it("replays cached extractions in subsequent snapshots", async () => {
+        for (let i = 0; i < SnapshotV1.chunkSize * 2; i++) {
+            str.append(`${i % 10}`, /* increaseMsn: */ true);
+        }
+        str.applyPendingOps();
+
+        // The first snapshot populates the merge tree's snapshot block cache; the second
+        // replays the cached extractions and must produce equivalent content.
+        const client1 = await loadSnapshot(str.getSnapshot());
+        const client2 = await loadSnapshot(str.getSnapshot());
+        assert.equal(client1.getText(), str.getText());
+        assert.equal(client2.getText(), str.getText());
+    });
+
+    it("invalidates cached extractions when a block changes", async () => {
+        for (let i = 0; i < SnapshotV1.chunkSize * 2; i++) {
+            str.append(`${i % 10}`, /* increaseMsn: */ true);
+        }
+        str.applyPendingOps();
+        await loadSnapshot(str.getSnapshot());
+
+        // Edit the middle of the document between snapshots; only the touched blocks
+        // should be re-extracted, and content must still roundtrip.
+        str.insert(SnapshotV1.chunkSize, "x", /* increaseMsn: */ true);
+        str.applyPendingOps();
+
+        const client2 = await loadSnapshot(str.getSnapshot());
+        assert.equal(client2.getText(), str.getText());
+    });
+});
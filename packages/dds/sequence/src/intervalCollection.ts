@@ -465,21 +465,33 @@ export class LocalIntervalCollection<TInterval extends ISerializableInterval> {
         }
     }
 
-    public findOverlappingIntervals(startPosition: number, endPosition: number) {
-        if (!this.intervalTree.intervals.isEmpty()) {
-            const transientInterval =
-                this.helpers.create(
-                    "transient",
-                    startPosition,
-                    endPosition,
-                    this.client,
-                    MergeTree.IntervalType.Transient);
-
-            const overlappingIntervalNodes = this.intervalTree.match(transientInterval);
-            return overlappingIntervalNodes.map((node) => node.key);
-        } else {
-            return [];
+    /**
+     * Gathers the intervals that overlap with the given range into the provided results array. Equivalent to
+     * findOverlappingIntervals, but lets callers that query on every change (e.g. to render annotations) reuse
+     * a results array instead of allocating a new one per query.
+     */
+    public gatherOverlappingIntervals(results: TInterval[], startPosition: number, endPosition: number) {
+        if (this.intervalTree.intervals.isEmpty()) {
+            return;
         }
+
+        const transientInterval =
+            this.helpers.create(
+                "transient",
+                startPosition,
+                endPosition,
+                this.client,
+                MergeTree.IntervalType.Transient);
+
+        this.intervalTree.mapMatches(transientInterval, (interval: TInterval) => {
+            results.push(interval);
+        });
+    }
+
+    public findOverlappingIntervals(startPosition: number, endPosition: number) {
+        const results: TInterval[] = [];
+        this.gatherOverlappingIntervals(results, startPosition, endPosition);
+        return results;
     }
 
     public previousInterval(pos: number) {
@@ -1026,6 +1038,18 @@ export class IntervalCollection<TInterval extends ISerializableInterval> extends
         return this.localCollection.findOverlappingIntervals(startPosition, endPosition);
     }
 
+    /**
+     * Gathers the intervals that overlap with the given range into the provided results array. Equivalent to
+     * findOverlappingIntervals, but lets callers reuse a results array across queries.
+     */
+    public gatherOverlappingIntervals(results: TInterval[], startPosition: number, endPosition: number) {
+        if (!this.attached) {
+            throw new Error("attachSequence must be called");
+        }
+
+        this.localCollection.gatherOverlappingIntervals(results, startPosition, endPosition);
+    }
+
     public map(fn: (interval: TInterval) => void) {
         if (!this.attached) {
             throw new Error("attachSequence must be called");
@@ -7,6 +7,7 @@ import { strict as assert } from "assert";
 import { ISummaryTree } from "@fluidframework/protocol-definitions";
 import { IChannelServices } from "@fluidframework/datastore-definitions";
 import {
+    IntervalType,
     Marker,
     ReferenceType,
     reservedMarkerIdKey,
@@ -21,6 +22,7 @@ import {
     MockEmptyDeltaConnection,
     MockStorage,
 } from "@fluidframework/test-runtime-utils";
+import { SequenceInterval } from "../intervalCollection";
 import { SharedString } from "../sharedString";
 import { SharedStringFactory } from "../sequenceFactory";
 
@@ -369,6 +371,29 @@ describe("SharedString", () => {
             assert.equal(sharedString2.getText(), "hello", "Could not remove text from remote string");
         });
 
+        it("can gather overlapping intervals into a provided results array", async () => {
+            sharedString.insertText(0, "hello world");
+            const intervals = sharedString.getIntervalCollection("intervals");
+            intervals.add(0, 2, IntervalType.SlideOnRemove);
+            intervals.add(1, 4, IntervalType.SlideOnRemove);
+            intervals.add(6, 8, IntervalType.SlideOnRemove);
+
+            // Process the messages.
+            containerRuntimeFactory.processAllMessages();
+
+            const results: SequenceInterval[] = [];
+            intervals.gatherOverlappingIntervals(results, 0, 4);
+            assert.equal(results.length, 2, "Should gather the intervals overlapping the range");
+            assert.deepEqual(
+                results,
+                intervals.findOverlappingIntervals(0, 4),
+                "Gathered intervals should match findOverlappingIntervals()");
+
+            // The results array is owned by the caller - a second query should append to it.
+            intervals.gatherOverlappingIntervals(results, 6, 8);
+            assert.equal(results.length, 3, "Should append the intervals overlapping the second range");
+        });
+
         it("can annotate the text", async () => {
             // Insert text with properties in the first shared string.
             const text = "hello world";
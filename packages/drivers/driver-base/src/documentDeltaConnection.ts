@@ -23,12 +23,26 @@ import {
 } from "@fluidframework/protocol-definitions";
 import { ITelemetryLogger } from "@fluidframework/common-definitions";
 import { debug } from "./debug";
+import { binaryOpsFeature, decodeOpEnvelope, isOpEnvelope } from "./opEnvelope";
 
 interface IEventListener {
     event: string;
     listener(...args: any[]): void;
 }
 
+/**
+ * The binary op envelope is negotiated through an optional feature map on the connect handshake.
+ * These extend IConnect / IConnected locally until the published protocol-definitions pick the
+ * field up; servers that do not understand the map ignore it and keep sending JSON.
+ */
+interface IConnectWithFeatures extends IConnect {
+    supportedFeatures?: Record<string, boolean>;
+}
+
+interface IConnectedWithFeatures extends IConnected {
+    supportedFeatures?: Record<string, boolean>;
+}
+
 /**
  * Represents a connection to a stream of delta updates
  */
@@ -55,6 +69,12 @@ export class DocumentDeltaConnection
      */
     private earlyOpHandlerAttached: boolean = false;
 
+    /**
+     * True once the server has confirmed it may deliver op batches as binary envelopes.
+     * The decode path keys off the frame itself, so this is informational (telemetry, tests).
+     */
+    protected binaryOpsEnabled: boolean = false;
+
     private socketConnectionTimeout: ReturnType<typeof setTimeout> | undefined;
 
     protected readonly submitManager: BatchManager<IDocumentMessage[]>;
@@ -111,11 +131,20 @@ export class DocumentDeltaConnection
             // Register for the event on socket.io
             // "error" is special - we already subscribed to it to modify error object on the fly.
             if (!this.closed && event !== "error" && this.listeners(event).length === 0) {
-                this.addTrackedListener(
-                    event,
-                    (...args: any[]) => {
-                        this.emit(event, ...args);
-                    });
+                if (event === "op") {
+                    // Op batches may arrive as binary envelopes - decode before emitting.
+                    this.addTrackedListener(
+                        event,
+                        (documentId: string, msgs: ISequencedDocumentMessage[] | ArrayBuffer | Uint8Array) => {
+                            this.emit(event, documentId, this.translateOps(msgs));
+                        });
+                } else {
+                    this.addTrackedListener(
+                        event,
+                        (...args: any[]) => {
+                            this.emit(event, ...args);
+                        });
+                }
             }
         });
     }
@@ -336,6 +365,8 @@ export class DocumentDeltaConnection
                 }
 
                 this.checkpointSequenceNumber = response.checkpointSequenceNumber;
+                this.binaryOpsEnabled =
+                    (response as IConnectedWithFeatures).supportedFeatures?.[binaryOpsFeature] === true;
 
                 this.removeConnectionListeners();
                 resolve(response);
@@ -367,7 +398,17 @@ export class DocumentDeltaConnection
                 fail(false, this.createErrorObject("connect_document_error", error));
             }));
 
-            this.socket.emit("connect_document", connectMessage);
+            // Advertise that this client can decode binary op envelopes.  Servers that do not
+            // understand the feature map ignore it.
+            const featureConnectMessage: IConnectWithFeatures = {
+                ...connectMessage,
+                supportedFeatures: {
+                    ...(connectMessage as IConnectWithFeatures).supportedFeatures,
+                    [binaryOpsFeature]: true,
+                },
+            };
+
+            this.socket.emit("connect_document", featureConnectMessage);
 
             // Give extra 2 seconds for handshake on top of socket connection timeout
             this.socketConnectionTimeout = setTimeout(() => {
@@ -376,11 +417,21 @@ export class DocumentDeltaConnection
         });
     }
 
-    protected earlyOpHandler = (documentId: string, msgs: ISequencedDocumentMessage[]) => {
-        debug("Queued early ops", msgs.length);
-        this.queuedMessages.push(...msgs);
+    protected earlyOpHandler = (documentId: string, msgs: ISequencedDocumentMessage[] | ArrayBuffer | Uint8Array) => {
+        const messages = this.translateOps(msgs);
+        debug("Queued early ops", messages.length);
+        this.queuedMessages.push(...messages);
     };
 
+    /**
+     * Translates an op batch payload received from the socket into messages, decoding the binary
+     * envelope when the server sent one.  Numeric fields are read straight out of the frame;
+     * only the payload sections go through JSON.
+     */
+    protected translateOps(msgs: ISequencedDocumentMessage[] | ArrayBuffer | Uint8Array): ISequencedDocumentMessage[] {
+        return isOpEnvelope(msgs) ? decodeOpEnvelope(msgs) : msgs;
+    }
+
     protected earlySignalHandler = (msg: ISignalMessage) => {
         debug("Queued early signals");
         this.queuedSignals.push(msg);
@@ -4,3 +4,6 @@
  */
 
 export * from "./documentDeltaConnection";
+// The encoder stays module-internal until a service produces binary envelopes; only the
+// negotiation/receive surface is part of the package API.
+export { binaryOpsFeature, decodeOpEnvelope, isOpEnvelope } from "./opEnvelope";
@@ -0,0 +1,250 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { ISequencedDocumentMessage } from "@fluidframework/protocol-definitions";
+
+/**
+ * Feature name used to negotiate the binary op envelope at connection time.  A client that
+ * understands the envelope advertises it in the connect message; a server that also understands it
+ * echoes the feature back in the connect response and may then deliver op batches as binary
+ * frames instead of JSON arrays.
+ */
+export const binaryOpsFeature = "fluid_binary_ops";
+
+/**
+ * Magic number identifying a binary op envelope ("FLOP" in ASCII), followed by a format version.
+ * Lets the receive path cheaply distinguish envelopes from anything else arriving on the wire.
+ */
+const envelopeMagic = 0x464c4f50;
+const envelopeVersion = 1;
+
+// Per-message flag bits.
+const hasClientId = 0x1;    // clientId is a string (it is null for server-generated messages)
+const hasExtras = 0x2;      // optional fields (metadata, traces, origin, ...) are present
+const hasTerm = 0x4;        // term is defined
+
+/**
+ * The binary envelope is a length-prefixed flat encoding of a batch of sequenced messages:
+ *
+ *   uint32 magic, uint8 version, uint32 count
+ *   per message:
+ *     uint8   flags
+ *     float64 sequenceNumber, minimumSequenceNumber, clientSequenceNumber,
+ *             referenceSequenceNumber, timestamp
+ *     float64 term                      (iff hasTerm)
+ *     string  type
+ *     string  clientId                  (iff hasClientId)
+ *     string  contents                  (JSON)
+ *     string  extras                    (JSON, iff hasExtras)
+ *
+ * where `string` is a uint32 byte length followed by UTF-8 bytes.  All multi-byte values are
+ * little-endian.  The numeric fields of every message are read straight out of the buffer with no
+ * intermediate string or object; only the payload sections are parsed, each from a single UTF-8
+ * slice of the frame.
+ */
+class EnvelopeWriter {
+    private buffer = new Uint8Array(4096);
+    private view = new DataView(this.buffer.buffer);
+    private position = 0;
+    private readonly encoder = new TextEncoder();
+
+    public writeUint8(value: number) {
+        this.ensure(1);
+        this.view.setUint8(this.position, value);
+        this.position += 1;
+    }
+
+    public writeUint32(value: number) {
+        this.ensure(4);
+        this.view.setUint32(this.position, value, true);
+        this.position += 4;
+    }
+
+    public writeFloat64(value: number) {
+        this.ensure(8);
+        this.view.setFloat64(this.position, value, true);
+        this.position += 8;
+    }
+
+    public writeString(value: string) {
+        // Reserve worst-case UTF-8 expansion plus the length prefix, encode directly into the
+        // buffer, then backfill the actual byte length.
+        this.ensure(4 + value.length * 3);
+        const lengthPosition = this.position;
+        this.position += 4;
+        const { written } = this.encoder.encodeInto(value, this.buffer.subarray(this.position));
+        // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+        this.view.setUint32(lengthPosition, written!, true);
+        // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+        this.position += written!;
+    }
+
+    public finish(): Uint8Array {
+        return this.buffer.subarray(0, this.position);
+    }
+
+    private ensure(bytes: number) {
+        if (this.position + bytes > this.buffer.length) {
+            let newLength = this.buffer.length * 2;
+            while (this.position + bytes > newLength) {
+                newLength *= 2;
+            }
+            const newBuffer = new Uint8Array(newLength);
+            newBuffer.set(this.buffer);
+            this.buffer = newBuffer;
+            this.view = new DataView(newBuffer.buffer);
+        }
+    }
+}
+
+class EnvelopeReader {
+    private position = 0;
+    private readonly view: DataView;
+    private readonly decoder = new TextDecoder();
+
+    constructor(private readonly buffer: Uint8Array) {
+        this.view = new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength);
+    }
+
+    public readUint8(): number {
+        const value = this.view.getUint8(this.position);
+        this.position += 1;
+        return value;
+    }
+
+    public readUint32(): number {
+        const value = this.view.getUint32(this.position, true);
+        this.position += 4;
+        return value;
+    }
+
+    public readFloat64(): number {
+        const value = this.view.getFloat64(this.position, true);
+        this.position += 8;
+        return value;
+    }
+
+    public readString(): string {
+        const length = this.readUint32();
+        const value = this.decoder.decode(this.buffer.subarray(this.position, this.position + length));
+        this.position += length;
+        return value;
+    }
+}
+
+/**
+ * Returns true if the given socket payload is a binary op envelope (rather than the JSON array
+ * of messages the server sends otherwise).
+ */
+export function isOpEnvelope(data: unknown): data is ArrayBuffer | Uint8Array {
+    let buffer: Uint8Array;
+    if (data instanceof ArrayBuffer) {
+        buffer = new Uint8Array(data);
+    } else if (data instanceof Uint8Array) {
+        buffer = data;
+    } else {
+        return false;
+    }
+    return buffer.byteLength >= 5
+        && new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength).getUint32(0, true) === envelopeMagic;
+}
+
+/**
+ * Encodes a batch of sequenced messages into a binary envelope.  No service in this repository
+ * produces envelopes yet, so the encoder is not re-exported from the package index; it is the
+ * reference implementation of the format and keeps the decode path testable.
+ */
+export function encodeOpEnvelope(messages: ISequencedDocumentMessage[]): Uint8Array {
+    const writer = new EnvelopeWriter();
+    writer.writeUint32(envelopeMagic);
+    writer.writeUint8(envelopeVersion);
+    writer.writeUint32(messages.length);
+
+    for (const message of messages) {
+        const { clientId, sequenceNumber, term, minimumSequenceNumber, clientSequenceNumber,
+            referenceSequenceNumber, type, contents, timestamp, ...extras } = message;
+
+        let flags = 0;
+        // eslint-disable-next-line no-null/no-null
+        if (clientId !== null && clientId !== undefined) {
+            flags |= hasClientId;
+        }
+        if (term !== undefined) {
+            flags |= hasTerm;
+        }
+        const hasExtraFields = Object.keys(extras).length > 0;
+        if (hasExtraFields) {
+            flags |= hasExtras;
+        }
+
+        writer.writeUint8(flags);
+        writer.writeFloat64(sequenceNumber);
+        writer.writeFloat64(minimumSequenceNumber);
+        writer.writeFloat64(clientSequenceNumber);
+        writer.writeFloat64(referenceSequenceNumber);
+        writer.writeFloat64(timestamp);
+        if ((flags & hasTerm) !== 0) {
+            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+            writer.writeFloat64(term!);
+        }
+        writer.writeString(type);
+        if ((flags & hasClientId) !== 0) {
+            writer.writeString(clientId);
+        }
+        writer.writeString(JSON.stringify(contents));
+        if (hasExtraFields) {
+            writer.writeString(JSON.stringify(extras));
+        }
+    }
+
+    return writer.finish();
+}
+
+/**
+ * Decodes a binary envelope back into a batch of sequenced messages.
+ */
+export function decodeOpEnvelope(data: ArrayBuffer | Uint8Array): ISequencedDocumentMessage[] {
+    const buffer = data instanceof ArrayBuffer ? new Uint8Array(data) : data;
+    const reader = new EnvelopeReader(buffer);
+
+    const magic = reader.readUint32();
+    const version = reader.readUint8();
+    if (magic !== envelopeMagic || version !== envelopeVersion) {
+        throw new Error(`Unrecognized op envelope (magic=${magic.toString(16)} version=${version})`);
+    }
+
+    const count = reader.readUint32();
+    const messages: ISequencedDocumentMessage[] = [];
+    for (let i = 0; i < count; i++) {
+        const flags = reader.readUint8();
+        const sequenceNumber = reader.readFloat64();
+        const minimumSequenceNumber = reader.readFloat64();
+        const clientSequenceNumber = reader.readFloat64();
+        const referenceSequenceNumber = reader.readFloat64();
+        const timestamp = reader.readFloat64();
+        const term = (flags & hasTerm) !== 0 ? reader.readFloat64() : undefined;
+        const type = reader.readString();
+        // eslint-disable-next-line no-null/no-null
+        const clientId = (flags & hasClientId) !== 0 ? reader.readString() : null as unknown as string;
+        const contents = JSON.parse(reader.readString());
+        const message: ISequencedDocumentMessage = {
+            clientId,
+            sequenceNumber,
+            term,
+            minimumSequenceNumber,
+            clientSequenceNumber,
+            referenceSequenceNumber,
+            type,
+            contents,
+            timestamp,
+        };
+        if ((flags & hasExtras) !== 0) {
+            Object.assign(message, JSON.parse(reader.readString()));
+        }
+        messages.push(message);
+    }
+
+    return messages;
+}
@@ -0,0 +1,120 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { ISequencedDocumentMessage, MessageType } from "@fluidframework/protocol-definitions";
+import { decodeOpEnvelope, encodeOpEnvelope, isOpEnvelope } from "../opEnvelope";
+
+function makeMessage(overrides: Partial<ISequencedDocumentMessage> = {}): ISequencedDocumentMessage {
+    return {
+        clientId: "clientA",
+        sequenceNumber: 42,
+        term: 1,
+        minimumSequenceNumber: 40,
+        clientSequenceNumber: 7,
+        referenceSequenceNumber: 41,
+        type: MessageType.Operation,
+        contents: { address: "root", op: { pos1: 0, seg: "hello" } },
+        timestamp: 1629072000000,
+        ...overrides,
+    };
+}
+
+describe("opEnvelope", () => {
+    it("round-trips a client op", () => {
+        const message = makeMessage();
+        const decoded = decodeOpEnvelope(encodeOpEnvelope([message]));
+        assert.deepStrictEqual(decoded, [message]);
+    });
+
+    it("round-trips a server message with null clientId and no term", () => {
+        const message = makeMessage({
+            // eslint-disable-next-line no-null/no-null
+            clientId: null as unknown as string,
+            term: undefined,
+            type: MessageType.NoOp,
+            // eslint-disable-next-line no-null/no-null
+            contents: null,
+        });
+        const decoded = decodeOpEnvelope(encodeOpEnvelope([message]));
+        assert.deepStrictEqual(decoded, [message]);
+    });
+
+    it("round-trips optional fields through the extras section", () => {
+        const message = makeMessage({
+            metadata: { batch: true },
+            origin: { id: "origin-doc", minimumSequenceNumber: 10, sequenceNumber: 12 },
+            traces: [{ service: "alfred", action: "start", timestamp: 1629072000001 }],
+        });
+        const decoded = decodeOpEnvelope(encodeOpEnvelope([message]));
+        assert.deepStrictEqual(decoded, [message]);
+    });
+
+    it("round-trips every flag combination in a single batch", () => {
+        const messages: ISequencedDocumentMessage[] = [];
+        let sequenceNumber = 1;
+        // eslint-disable-next-line no-null/no-null
+        for (const clientId of ["clientA", null as unknown as string]) {
+            for (const term of [1, undefined]) {
+                for (const extras of [{}, { metadata: { batch: false }, serverMetadata: { split: true } }]) {
+                    messages.push(makeMessage({ clientId, term, sequenceNumber: sequenceNumber++, ...extras }));
+                }
+            }
+        }
+        const decoded = decodeOpEnvelope(encodeOpEnvelope(messages));
+        assert.deepStrictEqual(decoded, messages);
+    });
+
+    it("round-trips multi-byte UTF-8 payloads larger than the initial buffer", () => {
+        // Each of these characters is one UTF-16 code unit but three UTF-8 bytes, exercising the
+        // worst-case reservation in writeString as well as buffer growth well past 4096 bytes.
+        const text = "éフルイド".repeat(5000);
+        const message = makeMessage({ contents: { text } });
+        const decoded = decodeOpEnvelope(encodeOpEnvelope([message]));
+        assert.deepStrictEqual(decoded, [message]);
+    });
+
+    it("decodes an envelope viewed at a non-zero byte offset", () => {
+        const message = makeMessage();
+        const encoded = encodeOpEnvelope([message]);
+        const padded = new Uint8Array(encoded.byteLength + 8);
+        padded.set(encoded, 8);
+        const view = padded.subarray(8);
+        assert(isOpEnvelope(view));
+        assert.deepStrictEqual(decodeOpEnvelope(view), [message]);
+    });
+
+    it("decodes from a bare ArrayBuffer", () => {
+        const message = makeMessage();
+        const encoded = encodeOpEnvelope([message]);
+        const buffer = encoded.buffer.slice(encoded.byteOffset, encoded.byteOffset + encoded.byteLength);
+        assert(isOpEnvelope(buffer));
+        assert.deepStrictEqual(decodeOpEnvelope(buffer), [message]);
+    });
+
+    it("round-trips an empty batch", () => {
+        assert.deepStrictEqual(decodeOpEnvelope(encodeOpEnvelope([])), []);
+    });
+
+    it("rejects payloads that are not envelopes", () => {
+        assert(!isOpEnvelope([makeMessage()]));
+        assert(!isOpEnvelope("FLOP"));
+        assert(!isOpEnvelope(undefined));
+        assert(!isOpEnvelope(new Uint8Array([0x50, 0x4f])), "short buffer");
+        assert(!isOpEnvelope(new Uint8Array([0, 1, 2, 3, 4])), "wrong magic");
+    });
+
+    it("throws on an unrecognized magic number or version", () => {
+        const encoded = encodeOpEnvelope([makeMessage()]);
+
+        const badMagic = new Uint8Array(encoded);
+        badMagic[0] ^= 0xff;
+        assert.throws(() => decodeOpEnvelope(badMagic));
+
+        const badVersion = new Uint8Array(encoded);
+        badVersion[4] = 0xff;
+        assert.throws(() => decodeOpEnvelope(badVersion));
+    });
+});
@@ -50,6 +50,21 @@ export interface IOpsCachingPolicy {
     totalOpsToCache?: number;
 }
 
+export interface ISnapshotBlobPrefetchOptions {
+    /**
+     * True to have the driver speculatively download snapshot blobs that were not part of the
+     * initial snapshot payload once the snapshot tree is known, instead of waiting for the
+     * runtime to request them one by one as data stores realize.
+     */
+    enabled: boolean;
+
+    /**
+     * Maximum number of blob downloads in flight at a time.
+     * Default: 4
+     */
+    concurrency?: number;
+}
+
 export interface ICollabSessionOptions {
     /**
      * Value indicating the display name for session that admits unauthenticated user.
@@ -86,7 +101,23 @@ export interface HostStoragePolicy {
      */
     sessionOptions?: ICollabSessionOptions;
 
+    /**
+     * Policy controlling speculative download of snapshot blobs once the snapshot tree is known.
+     * Blobs under routes the host declared boot-critical
+     * (see OdspDocumentServiceFactoryCore.declareBootCriticalRoutes) are downloaded first.
+     */
+    snapshotBlobPrefetch?: ISnapshotBlobPrefetchOptions;
+
     // True to have the sharing link redeem fallback in case the Trees Latest/Redeem 1RT call fails with redeem error.
     // During fallback it will first redeem the sharing link and then make the Trees latest call.
     enableRedeemFallback?: boolean;
+
+    /**
+     * If set to true, the initial snapshot is requested without blob contents (tree structure
+     * only) and blob contents are hydrated in the background via snapshot blob prefetch,
+     * boot-critical routes first. This lets large containers boot as soon as the blobs of the
+     * critical subtree land instead of waiting for the full snapshot payload to download.
+     * Has no effect on the summarizer client, which always fetches the full snapshot.
+     */
+    progressiveSnapshotBoot?: boolean;
 }
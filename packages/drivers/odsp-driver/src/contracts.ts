@@ -188,6 +188,12 @@ export interface IOdspSnapshot {
  */
 export interface HostStoragePolicyInternal extends HostStoragePolicy {
     summarizerClient?: boolean;
+
+    /**
+     * Routes (top-level snapshot tree paths, e.g. "default") the host expects to realize first
+     * during boot, in priority order. Used to order snapshot blob prefetch.
+     */
+    bootCriticalRoutes?: string[];
 }
 
 export interface ICreateFileResponse {
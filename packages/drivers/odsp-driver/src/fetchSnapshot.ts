@@ -255,7 +255,7 @@ async function fetchLatestSnapshotCore(
                 }
 
                 const { numTrees, numBlobs, encodedBlobsSize, decodedBlobsSize } =
-                    validateAndEvalBlobsAndTrees(snapshot);
+                    validateAndEvalBlobsAndTrees(snapshot, snapshotOptions?.blobs !== 0);
                 const clientTime = networkTime ? overallTime - networkTime : undefined;
 
                 // There are some scenarios in ODSP where we cannot cache, trees/latest will explicitly tell us when we
@@ -325,10 +325,11 @@ async function fetchLatestSnapshotCore(
     });
 }
 
-function validateAndEvalBlobsAndTrees(snapshot: IOdspSnapshot) {
+function validateAndEvalBlobsAndTrees(snapshot: IOdspSnapshot, requireBlobs: boolean) {
     assert(Array.isArray(snapshot.trees) && snapshot.trees.length > 0,
         0x200 /* "Returned odsp snapshot is malformed. No trees!" */);
-    assert(Array.isArray(snapshot.blobs) && snapshot.blobs.length > 0,
+    // A tree-only snapshot (blobs explicitly not requested) legitimately carries no blobs.
+    assert(!requireBlobs || Array.isArray(snapshot.blobs) && snapshot.blobs.length > 0,
         0x201 /* "Returned odsp snapshot is malformed. No blobs!" */);
     let numTrees = 0;
     let numBlobs = 0;
@@ -343,7 +344,7 @@ function validateAndEvalBlobsAndTrees(snapshot: IOdspSnapshot) {
             }
         }
     }
-    for (const blob of snapshot.blobs) {
+    for (const blob of snapshot.blobs ?? []) {
         decodedBlobsSize += blob.size;
         encodedBlobsSize += blob.content.length;
     }
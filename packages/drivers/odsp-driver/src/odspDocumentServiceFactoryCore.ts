@@ -30,6 +30,7 @@ import {
     createOdspCacheAndTracker,
     ICacheAndTracker,
 } from "./epochTracker";
+import { HostStoragePolicyInternal } from "./contracts";
 import { OdspDocumentService } from "./odspDocumentService";
 import { INewFileInfo, getOdspResolvedUrl, createOdspLogger, toInstrumentedOdspTokenFetcher } from "./odspUtils";
 import { createNewFluidFile } from "./createFile";
@@ -46,6 +47,18 @@ export class OdspDocumentServiceFactoryCore implements IDocumentServiceFactory {
 
     private readonly nonPersistentCache = new NonPersistentCache();
 
+    private readonly bootCriticalRoutes: string[] = [];
+
+    /**
+     * Declares snapshot tree routes (e.g. "default") the host expects to realize first during
+     * boot, in priority order. When snapshot blob prefetch is enabled through
+     * HostStoragePolicy.snapshotBlobPrefetch, blobs under these routes are downloaded before the
+     * rest of the tree. Must be called before creating the document service to affect a session.
+     */
+    public declareBootCriticalRoutes(routes: string[]) {
+        this.bootCriticalRoutes.push(...routes);
+    }
+
     public async createContainer(
         createNewSummary: ISummaryTree | undefined,
         createNewResolvedUrl: IResolvedUrl,
@@ -157,6 +170,11 @@ export class OdspDocumentServiceFactoryCore implements IDocumentServiceFactory {
                 false /* throwOnNullToken */,
             )(options, "GetWebsocketToken");
 
+        const hostPolicy: HostStoragePolicyInternal = {
+            ...this.hostPolicy,
+            bootCriticalRoutes: this.bootCriticalRoutes,
+        };
+
         return OdspDocumentService.create(
             resolvedUrl,
             storageTokenFetcher,
@@ -164,7 +182,7 @@ export class OdspDocumentServiceFactoryCore implements IDocumentServiceFactory {
             odspLogger,
             this.getSocketIOClient,
             cacheAndTracker.cache,
-            this.hostPolicy,
+            hostPolicy,
             cacheAndTracker.epochTracker,
         );
     }
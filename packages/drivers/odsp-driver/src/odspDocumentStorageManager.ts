@@ -178,6 +178,14 @@ class BlobCache {
         return { blobContent, evicted };
     }
 
+    /**
+     * Presence check that (unlike getBlob) does not reset the cache-clear timer.
+     * Used by the prefetch pipeline to skip blobs it does not need to download.
+     */
+    public hasBlob(blobId: string) {
+        return this._blobCache.has(blobId);
+    }
+
     public setBlob(blobId: string, blob: IOdspSnapshotBlob | ArrayBuffer) {
         // This API is called as result of cache miss and reading blob from storage.
         // Runtime never reads same blob twice.
@@ -243,6 +251,9 @@ export class OdspDocumentStorageService implements IDocumentStorageService {
 
     private readonly blobCache = new BlobCache();
 
+    // Ensures we only kick off the speculative snapshot blob prefetch once per session.
+    private snapshotBlobPrefetchStarted = false;
+
     public set ops(ops: ISequencedDeltaOpMessage[] | undefined) {
         assert(this._ops === undefined, 0x0a5 /* "Trying to set ops when they are already set!" */);
         this._ops = ops;
@@ -447,9 +458,93 @@ export class OdspDocumentStorageService implements IDocumentStorageService {
             const protocolTree = hierarchicalTree.trees[".protocol"];
             finalTree = this.combineProtocolAndAppSnapshotTree(appTree, protocolTree);
         }
+
+        // Progressive boot relies on background hydration, so it implies blob prefetch.
+        if ((this.hostPolicy.snapshotBlobPrefetch?.enabled === true
+            || this.hostPolicy.progressiveSnapshotBoot === true) && finalTree !== undefined) {
+            this.prefetchSnapshotBlobs(finalTree);
+        }
+
         return finalTree;
     }
 
+    /**
+     * Speculatively downloads snapshot blobs that are not in the blob cache, so that later
+     * readBlob calls during data store realization are served from memory instead of each
+     * paying a network round trip. Routes the host declared boot-critical are fetched first;
+     * the rest of the tree follows in breadth-first order. Fire-and-forget: failures are
+     * logged and the blob in question is simply fetched on demand as before.
+     */
+    private prefetchSnapshotBlobs(tree: api.ISnapshotTree): void {
+        if (this.snapshotBlobPrefetchStarted) {
+            return;
+        }
+        this.snapshotBlobPrefetchStarted = true;
+
+        // Collect pending blob ids breadth-first, tagging each with its top-level route.
+        const pending: string[] = [];
+        const seen = new Set<string>();
+        const routeRank = new Map<string, number>();
+        const routes = this.hostPolicy.bootCriticalRoutes ?? [];
+        const queue: { tree: api.ISnapshotTree, route: string | undefined }[] =
+            [{ tree, route: undefined }];
+        while (queue.length > 0) {
+            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+            const { tree: node, route } = queue.shift()!;
+            for (const blobId of Object.values(node.blobs)) {
+                if (blobId && !seen.has(blobId) && !this.blobCache.hasBlob(blobId)) {
+                    seen.add(blobId);
+                    pending.push(blobId);
+                    routeRank.set(blobId, route !== undefined ? routes.indexOf(route) : -1);
+                }
+            }
+            for (const [path, childTree] of Object.entries(node.trees)) {
+                queue.push({ tree: childTree, route: route ?? path });
+            }
+        }
+        if (pending.length === 0) {
+            return;
+        }
+
+        // Boot-critical routes first (in declaration order), then everything else.
+        pending.sort((a, b) => {
+            const rankOf = (rank: number | undefined) =>
+                rank === undefined || rank < 0 ? routes.length : rank;
+            return rankOf(routeRank.get(a)) - rankOf(routeRank.get(b));
+        });
+
+        const concurrency = this.hostPolicy.snapshotBlobPrefetch?.concurrency ?? 4;
+        // eslint-disable-next-line @typescript-eslint/no-floating-promises
+        PerformanceEvent.timedExecAsync(
+            this.logger,
+            {
+                eventName: "PrefetchSnapshotBlobs",
+                blobCount: pending.length,
+                concurrency,
+            },
+            async (event) => {
+                let fetched = 0;
+                let failed = 0;
+                const fetchNext = async (): Promise<void> => {
+                    const blobId = pending.shift();
+                    if (blobId === undefined) {
+                        return;
+                    }
+                    try {
+                        await this.readBlobCore(blobId);
+                        fetched++;
+                    } catch (error) {
+                        // Speculative fetch - the runtime will retry on demand if it needs the blob.
+                        failed++;
+                    }
+                    return fetchNext();
+                };
+                await Promise.all(Array.from({ length: concurrency }, async () => fetchNext()));
+                event.end({ fetched, failed });
+            },
+        ).catch(() => {});
+    }
+
     public async getVersions(blobid: string | null, count: number): Promise<api.IVersion[]> {
         // Regular load workflow uses blobId === documentID to indicate "latest".
         if (blobid !== this.documentId && blobid) {
@@ -601,6 +696,13 @@ export class OdspDocumentStorageService implements IDocumentStorageService {
         if (this.hostPolicy.summarizerClient) {
             snapshotOptions.mds = undefined;
             snapshotOptions.timeout = undefined;
+        } else if (this.hostPolicy.progressiveSnapshotBoot === true) {
+            // Progressive boot: request the tree structure only and hydrate blob contents in the
+            // background (see prefetchSnapshotBlobs), so boot waits for the boot-critical blobs
+            // to land instead of the full snapshot payload. A tree-only payload is small, so the
+            // size limit does not apply.
+            snapshotOptions.blobs = 0;
+            snapshotOptions.mds = undefined;
         }
 
         const snapshotDownloader = async (url: string, fetchOptions: {[index: string]: any}) => {
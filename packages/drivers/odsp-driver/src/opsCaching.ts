@@ -95,8 +95,9 @@ export class OpsCache {
                 currentBatch.remainingSlots--;
                 currentBatch.dirty = true;
             } else {
-                // Either batch was flushed or this op was already there - nothing to do!
-                return;
+                // Either batch was flushed or this op was already there - nothing to do for this op, but later
+                // ops in the call may still land in other batches.
+                continue;
             }
 
             if (currentBatch.remainingSlots === 0) {
@@ -117,16 +118,31 @@ export class OpsCache {
         }
     }
 
+    // How many batch reads to keep in flight ahead of the one being processed in get(). Reads go to the host's
+    // async cache (typically IndexedDB), so overlapping the round trips dominates the cost of reading a long
+    // range. Reads issued past the end of the cached range harmlessly resolve to undefined.
+    private static readonly concurrentReads = 3;
+
     public async get(from: number, to?: number): Promise<IMessage[]> {
         const messages: IMessage[] = [];
-        let batchNumber = this.getBatchNumber(from + 1);
         const start = performance.now();
+        let nextBatchToRead = this.getBatchNumber(from + 1);
+        const pendingReads: Promise<string | undefined>[] = [];
+        const issueRead = () => {
+            pendingReads.push(this.cache.read(`${this.batchSize}_${nextBatchToRead}`));
+            nextBatchToRead++;
+        };
+        for (let i = 0; i < OpsCache.concurrentReads; i++) {
+            issueRead();
+        }
         // eslint-disable-next-line no-constant-condition
         while (true) {
-            const res = await this.cache.read(`${this.batchSize}_${batchNumber}`);
+            // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+            const res = await pendingReads.shift()!;
             if (res === undefined) {
                 break;
             }
+            issueRead();
             const result: CacheEntry = JSON.parse(res);
             for (const op of result) {
                 // Note that we write out undefined, but due to JSON.stringify, it turns into null!
@@ -146,8 +162,6 @@ export class OpsCache {
                     break;
                 }
             }
-
-            batchNumber++;
         }
         if (messages.length > 0) {
             this.logger.sendPerformanceEvent({
@@ -251,6 +251,33 @@ describe("OpsCache", () => {
             2);
     });
 
+    it("ops following a duplicate in the same call are still cached", async () => {
+        const mockCache = new MockCache();
+        const cache = new OpsCache(
+            100,
+            new TelemetryUTLogger(),
+            mockCache,
+            5, // batchSize
+            -1, // timerGranularity
+            20, // totalOpsToCache
+        );
+
+        cache.addOps([
+            { sequenceNumber: 101, data: "101" },
+            { sequenceNumber: 102, data: "102" },
+        ]);
+
+        // Replay the first op together with new ones - the duplicate should be skipped, not end the call.
+        cache.addOps([
+            { sequenceNumber: 101, data: "101" },
+            { sequenceNumber: 103, data: "103" },
+            { sequenceNumber: 104, data: "104" },
+        ]);
+
+        cache.flushOps();
+        assert.equal(mockCache.opsWritten, 4);
+    });
+
     it("Too many ops", async () => {
         await runTest(
             5,
@@ -13,6 +13,7 @@ import { ITelemetryLogger } from "@fluidframework/common-definitions";
 import { DeltaStorageService, DocumentDeltaStorageService } from "./deltaStorageService";
 import { DocumentStorageService } from "./documentStorageService";
 import { R11sDocumentDeltaConnection } from "./documentDeltaConnection";
+import { R11sWebSocketDeltaConnection } from "./wsDeltaConnection";
 import { NullBlobStorageService } from "./nullBlobStorageService";
 import { ITokenProvider } from "./tokens";
 import { RouterliciousOrdererRestWrapper, RouterliciousStorageRestWrapper } from "./restWrapper";
@@ -106,6 +107,16 @@ export class DocumentService implements api.IDocumentService {
                 this.tenantId,
                 this.documentId,
             );
+            if (this.driverPolicies.enableNativeWebSocketDeltaStream) {
+                return R11sWebSocketDeltaConnection.createOverWebSocket(
+                    this.tenantId,
+                    this.documentId,
+                    ordererToken.jwt,
+                    client,
+                    this.ordererUrl,
+                    this.logger,
+                );
+            }
             return R11sDocumentDeltaConnection.create(
                 this.tenantId,
                 this.documentId,
@@ -11,3 +11,4 @@ export * from "./documentStorageService";
 export * from "./nullBlobStorageService";
 export * from "./policies";
 export * from "./tokens";
+export * from "./wsDeltaConnection";
@@ -19,4 +19,10 @@ export interface IRouterliciousDriverPolicies {
      * Default: 100
      */
     maxConcurrentOrdererRequests: number;
+    /**
+     * Connect to the delta stream over the service's native WebSocket endpoint instead of
+     * socket.io. Requires the service to have the endpoint enabled.
+     * Default: false
+     */
+    enableNativeWebSocketDeltaStream: boolean;
 }
@@ -0,0 +1,139 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { EventEmitter } from "events";
+import { ITelemetryLogger } from "@fluidframework/common-definitions";
+import { IDocumentDeltaConnection } from "@fluidframework/driver-definitions";
+import { IClient, IConnect } from "@fluidframework/protocol-definitions";
+import WebSocket from "isomorphic-ws";
+import { R11sDocumentDeltaConnection } from "./documentDeltaConnection";
+
+const protocolVersions = ["^0.4.0", "^0.3.0", "^0.2.0", "^0.1.0"];
+
+// Path the native WebSocket delta stream endpoint is mounted on by the server. Must match
+// the server's "alfred:nativeWebSocket:path" configuration.
+const nativeWebSocketPath = "/fluid-ws";
+
+/**
+ * Adapts a raw WebSocket to the subset of the socket.io client surface that
+ * DocumentDeltaConnection uses (on / off / removeListener / emit / disconnect).
+ *
+ * The wire framing matches the server's native endpoint: text frames are JSON encoded
+ * "[event, ...args]" arrays; binary frames carry op envelopes and are surfaced as "op"
+ * events for the base class to decode. Compression is negotiated at the transport level
+ * via permessage-deflate, so there is no protocol layer between the frames and the wire.
+ */
+class WebSocketShim {
+    private readonly events = new EventEmitter();
+    private readonly socket: WebSocket;
+    private opened = false;
+    private pendingFrames: string[] = [];
+
+    constructor(url: string, private readonly documentId: string) {
+        this.socket = new WebSocket(url);
+        this.socket.binaryType = "arraybuffer";
+        this.socket.onopen = () => {
+            this.opened = true;
+            for (const frame of this.pendingFrames) {
+                this.socket.send(frame);
+            }
+            this.pendingFrames = [];
+        };
+        this.socket.onmessage = (event) => {
+            this.handleMessage(event.data);
+        };
+        this.socket.onerror = (event) => {
+            // Before the socket opens, surface transport errors the way socket.io does so
+            // that DocumentDeltaConnection's connection failure handling applies.
+            this.events.emit(
+                this.opened ? "error" : "connect_error",
+                (event as { message?: string }).message ?? "WebSocket error");
+        };
+        this.socket.onclose = (event) => {
+            this.events.emit("disconnect", event.reason);
+        };
+    }
+
+    public on(event: string, listener: (...args: any[]) => void) {
+        this.events.on(event, listener);
+    }
+
+    public off(event: string, listener: (...args: any[]) => void) {
+        this.events.removeListener(event, listener);
+    }
+
+    public removeListener(event: string, listener: (...args: any[]) => void) {
+        this.events.removeListener(event, listener);
+    }
+
+    public emit(event: string, ...args: any[]) {
+        const frame = JSON.stringify([event, ...args]);
+        if (this.opened) {
+            this.socket.send(frame);
+        } else {
+            // The connect_document handshake is emitted before the socket finishes opening;
+            // queue frames until then, like socket.io's send buffer.
+            this.pendingFrames.push(frame);
+        }
+    }
+
+    public disconnect() {
+        this.socket.close();
+    }
+
+    private handleMessage(data: any) {
+        if (typeof data !== "string") {
+            // Binary frames are op envelopes; the base class decodes them.
+            this.events.emit("op", this.documentId, data);
+            return;
+        }
+
+        let frame: any;
+        try {
+            frame = JSON.parse(data);
+        } catch {
+            this.events.emit("error", "Invalid message frame");
+            return;
+        }
+
+        if (Array.isArray(frame) && typeof frame[0] === "string") {
+            this.events.emit(frame[0], ...frame.slice(1));
+        }
+    }
+}
+
+/**
+ * Delta connection over the server's native WebSocket endpoint instead of socket.io.
+ * Shares all handshake, queuing and error translation logic with the socket.io path
+ * through R11sDocumentDeltaConnection.
+ */
+export class R11sWebSocketDeltaConnection extends R11sDocumentDeltaConnection {
+    public static async createOverWebSocket(
+        tenantId: string,
+        id: string,
+        token: string | null,
+        client: IClient,
+        url: string,
+        logger: ITelemetryLogger,
+        timeoutMs = 20000): Promise<IDocumentDeltaConnection> {
+        const wsUrl = `${url.replace(/^http/, "ws")}${nativeWebSocketPath}`;
+        const socket = new WebSocketShim(wsUrl, id);
+
+        const connectMessage: IConnect = {
+            client,
+            id,
+            mode: client.mode,
+            tenantId,
+            token,  // Token is going to indicate tenant level information, etc...
+            versions: protocolVersions,
+        };
+
+        const deltaConnection = new R11sWebSocketDeltaConnection(
+            socket as unknown as SocketIOClient.Socket, id, logger);
+
+        await deltaConnection.initialize(connectMessage, timeoutMs);
+        return deltaConnection;
+    }
+}
@@ -52,10 +52,19 @@ export class DeltaQueue<T> extends TypedEventEmitter<IDeltaQueueEvents<T>> imple
 
     /**
      * @param worker - A callback to process a delta.
-     * @param logger - For logging telemetry.
+     * @param batchWorker - An optional callback to process a contiguous run of deltas in a single
+     * call. When provided, the processing loop drains up to `batchSize` queued deltas at a time
+     * and hands them to this callback instead of invoking `worker` per delta. The callback
+     * returns the number of deltas it actually processed; any remainder is re-queued, which lets
+     * the callback honor a pause request mid-run. "op" events are emitted for each processed
+     * delta once its run completes.
+     * @param batchSize - Maximum number of deltas handed to `batchWorker` per call. Bounds how
+     * long a pause request can take to be honored.
      */
     constructor(
         private readonly worker: (delta: T) => void,
+        private readonly batchWorker?: (deltas: T[]) => number,
+        private readonly batchSize = 100,
     ) {
         super();
     }
@@ -128,6 +137,33 @@ export class DeltaQueue<T> extends TypedEventEmitter<IDeltaQueueEvents<T>> imple
         // For grouping to work we must process all local messages immediately and in the single turn.
         // So loop over them until no messages to process, we have become paused, or hit an error.
         while (!(this.q.length === 0 || this.paused || this.error !== undefined)) {
+            if (this.batchWorker !== undefined && this.q.length > 1) {
+                // Drain a contiguous run of deltas and hand it to the batch worker in one call.
+                // Pause and error state are rechecked between runs.
+                const batch: T[] = [];
+                while (batch.length < this.batchSize && this.q.length > 0) {
+                    // We know shift() returns a value since we just checked the length.
+                    // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+                    batch.push(this.q.shift()!);
+                }
+                try {
+                    const processed = this.batchWorker(batch);
+                    // Re-queue anything the worker did not get to (e.g. it observed a pause
+                    // request part way through the run).
+                    for (let i = batch.length - 1; i >= processed; i--) {
+                        this.q.unshift(batch[i]);
+                    }
+                    count += processed;
+                    for (let i = 0; i < processed; i++) {
+                        this.emit("op", batch[i]);
+                    }
+                } catch (error) {
+                    this.error = error;
+                    this.emit("error", error);
+                }
+                continue;
+            }
+
             // Get the next message in the queue
             const next = this.q.shift();
             count++;
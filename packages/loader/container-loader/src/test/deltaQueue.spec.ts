@@ -0,0 +1,103 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { DeltaQueue } from "../deltaQueue";
+
+describe("Loader", () => {
+    describe("Container Loader", () => {
+        describe("Delta Queue", () => {
+            // Yields control so the queue's processing microtask can run.
+            async function yieldEventLoop(): Promise<void> {
+                await new Promise<void>((resolve) => {
+                    setTimeout(resolve, 0);
+                });
+            }
+
+            it("processes queued deltas through the batch worker", async () => {
+                const processed: number[] = [];
+                const batchSizes: number[] = [];
+                const queue = new DeltaQueue<number>(
+                    (delta) => { processed.push(delta); },
+                    (deltas) => {
+                        batchSizes.push(deltas.length);
+                        processed.push(...deltas);
+                        return deltas.length;
+                    });
+
+                for (let i = 0; i < 10; i++) {
+                    queue.push(i);
+                }
+                queue.resume();
+                await queue.waitTillProcessingDone();
+
+                assert.deepStrictEqual(processed, [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+                assert.strictEqual(batchSizes.length, 1, "Contiguous run should be handed over in one call");
+            });
+
+            it("emits an op event for every delta processed in a batch", async () => {
+                const opEvents: number[] = [];
+                const queue = new DeltaQueue<number>(
+                    () => { },
+                    (deltas) => deltas.length);
+                queue.on("op", (delta: number) => opEvents.push(delta));
+
+                for (let i = 0; i < 5; i++) {
+                    queue.push(i);
+                }
+                queue.resume();
+                await queue.waitTillProcessingDone();
+
+                assert.deepStrictEqual(opEvents, [0, 1, 2, 3, 4]);
+            });
+
+            it("re-queues deltas the batch worker did not process", async () => {
+                const processed: number[] = [];
+                const queue = new DeltaQueue<number>(
+                    (delta) => { processed.push(delta); },
+                    (deltas) => {
+                        // Simulate a worker that observes a pause request after two deltas.
+                        processed.push(deltas[0], deltas[1]);
+                        // eslint-disable-next-line @typescript-eslint/no-floating-promises
+                        queue.pause();
+                        return 2;
+                    });
+
+                for (let i = 0; i < 6; i++) {
+                    queue.push(i);
+                }
+                queue.resume();
+                await queue.waitTillProcessingDone();
+
+                assert.deepStrictEqual(processed, [0, 1]);
+                assert.strictEqual(queue.length, 4, "Unprocessed deltas should remain queued in order");
+                assert.strictEqual(queue.peek(), 2);
+
+                queue.resume();
+                await yieldEventLoop();
+                assert.deepStrictEqual(processed, [0, 1, 2, 3]);
+            });
+
+            it("caps the number of deltas handed to the batch worker", async () => {
+                const batchSizes: number[] = [];
+                const queue = new DeltaQueue<number>(
+                    () => { },
+                    (deltas) => {
+                        batchSizes.push(deltas.length);
+                        return deltas.length;
+                    },
+                    3 /* batchSize */);
+
+                for (let i = 0; i < 8; i++) {
+                    queue.push(i);
+                }
+                queue.resume();
+                await queue.waitTillProcessingDone();
+
+                assert.deepStrictEqual(batchSizes, [3, 3, 2]);
+            });
+        });
+    });
+});
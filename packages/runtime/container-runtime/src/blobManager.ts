@@ -5,11 +5,13 @@
 
 import { IFluidHandle, IFluidHandleContext } from "@fluidframework/core-interfaces";
 import { IDocumentStorageService } from "@fluidframework/driver-definitions";
+import { RateLimiter } from "@fluidframework/driver-utils";
 import { AttachmentTreeEntry } from "@fluidframework/protocol-base";
 import { ISnapshotTree, ITree } from "@fluidframework/protocol-definitions";
 import { generateHandleContextPath } from "@fluidframework/runtime-utils";
 import { ITelemetryLogger } from "@fluidframework/common-definitions";
-import { assert, Deferred } from "@fluidframework/common-utils";
+import { assert, Deferred, hashFile, IsoBuffer } from "@fluidframework/common-utils";
+import { PerformanceEvent } from "@fluidframework/telemetry-utils";
 import { IContainerRuntime } from "@fluidframework/container-runtime-definitions";
 import { AttachState } from "@fluidframework/container-definitions";
 
@@ -50,8 +52,20 @@ export class BlobHandle implements IFluidHandle<ArrayBufferLike> {
 
 export class BlobManager {
     public static readonly basePath = "_blobs";
+    private static readonly maxConcurrentUploads = 4;
     private readonly pendingBlobIds: Map<string, Deferred<void>> = new Map();
     private readonly blobIds: Set<string> = new Set();
+    /**
+     * Maps content hash to the storage ID the first upload of that content resolved to, so repeated
+     * createBlob() calls with identical payloads (e.g. the same image pasted multiple times) skip
+     * the upload round trip. Storage de-dups identical content server-side, so reusing the ID is
+     * equivalent to uploading again. Only populated while attached - detached blob storage IDs are
+     * not stable across attach.
+     */
+    private readonly storageIdByHash: Map<string, string> = new Map();
+    // Bounds how many uploads are in flight to storage at once; additional createBlob() calls
+    // queue here instead of racing each other for the connection.
+    private readonly uploadLimiter = new RateLimiter(BlobManager.maxConcurrentUploads);
 
     public get blobCount() { return this.blobIds.size; }
 
@@ -83,12 +97,27 @@ export class BlobManager {
             this.runtime.attachState !== AttachState.Attaching,
             0x1f9 /* "createBlob() while attaching not supported" */,
         );
-        const response = await this.getStorage().createBlob(blob);
+        const hash = await hashFile(IsoBuffer.from(blob));
+        let storageId = this.storageIdByHash.get(hash);
+        if (storageId === undefined) {
+            const waitQueueLength = this.uploadLimiter.waitQueueLength;
+            const response = await this.uploadLimiter.schedule(async () =>
+                PerformanceEvent.timedExecAsync(
+                    this.logger,
+                    { eventName: "BlobUpload", size: blob.byteLength, waitQueueLength },
+                    async () => this.getStorage().createBlob(blob),
+                ));
+            storageId = response.id;
+            if (this.runtime.attachState !== AttachState.Detached) {
+                this.storageIdByHash.set(hash, storageId);
+            }
+        }
+        const blobId = storageId;
 
         const handle = new BlobHandle(
-            `${BlobManager.basePath}/${response.id}`,
+            `${BlobManager.basePath}/${blobId}`,
             this.routeContext,
-            async () => this.getStorage().readBlob(response.id),
+            async () => this.getStorage().readBlob(blobId),
         );
 
         if (this.runtime.attachState === AttachState.Detached) {
@@ -96,14 +125,14 @@ export class BlobManager {
         }
 
         // Note - server will de-dup blobs, so we might get existing blobId!
-        if (this.pendingBlobIds.has(response.id)) {
-            await this.pendingBlobIds.get(response.id)?.promise;
-        } else if (!this.blobIds.has(response.id)) {
-            this.pendingBlobIds.set(response.id, new Deferred<void>());
+        if (this.pendingBlobIds.has(blobId)) {
+            await this.pendingBlobIds.get(blobId)?.promise;
+        } else if (!this.blobIds.has(blobId)) {
+            this.pendingBlobIds.set(blobId, new Deferred<void>());
 
             // send blob attach op and wait until we see it to return the handle
-            this.attachBlobCallback(response.id);
-            await this.pendingBlobIds.get(response.id)?.promise;
+            this.attachBlobCallback(blobId);
+            await this.pendingBlobIds.get(blobId)?.promise;
         }
 
         return handle;
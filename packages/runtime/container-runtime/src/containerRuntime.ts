@@ -42,6 +42,7 @@ import {
     ChildLogger,
     raiseConnectedEvent,
     PerformanceEvent,
+    TelemetrySpanSampler,
 } from "@fluidframework/telemetry-utils";
 import { IDocumentStorageService, ISummaryContext } from "@fluidframework/driver-definitions";
 import {
@@ -270,6 +271,23 @@ export interface ISummaryRuntimeOptions {
      * THis defaults to false (disabled) and must be explicitly set to true to enable.
      */
     summarizerClientElection?: boolean;
+
+    /**
+     * When set, summary tree generation yields back to the event loop whenever it has run
+     * for longer than this many milliseconds without yielding. Data stores are summarized
+     * sequentially instead of in a single microtask chain, so timers, socket traffic and
+     * signal processing can interleave with a large summary. Undefined (the default) keeps
+     * the existing behavior of summarizing all data stores without yielding.
+     */
+    summarizeYieldThresholdMs?: number;
+
+    /**
+     * Flag that will enable preloading a standby summarizer container while this client is next
+     * in line for summarizer election, so that failover after the elected client stops summarizing
+     * skips the full container boot. Costs an extra non-interactive container and connection on
+     * the next-in-line client. Defaults to false (disabled).
+     */
+    enableWarmStandbySummarizer?: boolean;
 }
 
 /**
@@ -278,6 +296,14 @@ export interface ISummaryRuntimeOptions {
 export interface IContainerRuntimeOptions {
     summaryOptions?: ISummaryRuntimeOptions;
     gcOptions?: IGCRuntimeOptions;
+
+    /**
+     * Sampling rate for flamegraph-style timing spans covering op processing, inbound queue
+     * turns, data store realization and summary generation: 1-in-N op processing roots are
+     * recorded and emitted as performance events through the container's logger. 0 (the
+     * default) disables span telemetry entirely, leaving no overhead on hot paths.
+     */
+    spanTelemetrySamplingRate?: number;
 }
 
 interface IRuntimeMessageMetadata {
@@ -334,10 +360,12 @@ export class ScheduleManager {
         private readonly deltaManager: IDeltaManager<ISequencedDocumentMessage, IDocumentMessage>,
         private readonly emitter: EventEmitter,
         private readonly logger: ITelemetryLogger,
+        spanSampler?: TelemetrySpanSampler,
     ) {
         this.deltaScheduler = new DeltaScheduler(
             this.deltaManager,
             ChildLogger.create(this.logger, "DeltaScheduler"),
+            spanSampler,
         );
 
         // Listen for delta manager sends and add batch metadata to messages
@@ -519,6 +547,7 @@ function getBackCompatRuntimeOptions(runtimeOptions?: IContainerRuntimeOptions):
     const backCompatOptions: IContainerRuntimeOptions = {
         summaryOptions,
         gcOptions,
+        spanTelemetrySamplingRate: runtimeOptions.spanTelemetrySamplingRate ?? 0,
     };
 
     return backCompatOptions;
@@ -586,6 +615,7 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
         const defaultRuntimeOptions: Required<IContainerRuntimeOptions> = {
             summaryOptions: { generateSummaries: true },
             gcOptions: {},
+            spanTelemetrySamplingRate: 0,
         };
         const combinedRuntimeOptions = { ...defaultRuntimeOptions, ...backCompatRuntimeOptions };
 
@@ -700,6 +730,12 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
 
     // internal logger for ContainerRuntime. Use this.logger for stores, summaries, etc.
     private readonly _logger: ITelemetryLogger;
+
+    /**
+     * Sampled flamegraph-style timing spans for hot paths (op processing, data store
+     * realization, summary generation). No-op unless spanTelemetrySamplingRate is set.
+     */
+    public readonly spanSampler: TelemetrySpanSampler;
     private readonly summarizerClientElection: SummarizerClientElection;
     private readonly summaryManager: SummaryManager;
     private readonly summaryCollection: SummaryCollection;
@@ -817,6 +853,10 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
 
         this._logger = ChildLogger.create(this.logger, "ContainerRuntime");
 
+        this.spanSampler = new TelemetrySpanSampler(
+            ChildLogger.create(this.logger, "Span"),
+            this.runtimeOptions.spanTelemetrySamplingRate);
+
         const loadedFromSequenceNumber = this.deltaManager.initialSequenceNumber;
         this.summarizerNode = createRootSummarizerNodeWithGC(
             this.logger,
@@ -876,6 +916,7 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
             context.deltaManager,
             this,
             ChildLogger.create(this.logger, "ScheduleManager"),
+            this.spanSampler,
         );
 
         this.deltaSender = this.deltaManager;
@@ -953,6 +994,7 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
             this.runtimeOptions.summaryOptions.generateSummaries !== false,
             this.logger,
             this.runtimeOptions.summaryOptions.initialSummarizerDelayMs,
+            this.runtimeOptions.summaryOptions.enableWarmStandbySummarizer === true,
         );
 
         if (this.connected) {
@@ -1302,6 +1344,18 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
             return;
         }
 
+        // Sampled root span for op processing; spans started while it is open (e.g. realizing
+        // a data store in order to apply the op) are recorded as its children.
+        this.spanSampler.runSampledSpan(
+            {
+                eventName: "ProcessOp",
+                messageType: messageArg.type,
+                sequenceNumber: messageArg.sequenceNumber,
+            },
+            () => this.processRuntimeMessage(messageArg, local));
+    }
+
+    private processRuntimeMessage(messageArg: ISequencedDocumentMessage, local: boolean) {
         // Do shallow copy of message, as methods below will modify it.
         // There might be multiple container instances receiving same message
         // We do not need to make deep copy, as each layer will just replace message.content itself,
@@ -1635,7 +1689,11 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
     }
 
     private async summarizeInternal(fullTree: boolean, trackState: boolean): Promise<ISummarizeInternalResult> {
-        const summarizeResult = await this.dataStores.summarize(fullTree, trackState);
+        const summarizeResult = await this.dataStores.summarize(
+            fullTree,
+            trackState,
+            this.runtimeOptions.summaryOptions.summarizeYieldThresholdMs,
+        );
         let pathPartsForChildren: string[] | undefined;
 
         if (!this.disableIsolatedChannels) {
@@ -1669,10 +1727,14 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
         const { summaryLogger, fullTree = false, trackState = true, runGC = true, fullGC = false } = options;
 
         if (runGC) {
-            await this.collectGarbage(summaryLogger, fullGC);
+            await this.spanSampler.runSpanAsync(
+                { eventName: "GarbageCollection" },
+                async () => this.collectGarbage(summaryLogger, fullGC));
         }
 
-        const summarizeResult = await this.summarizerNode.summarize(fullTree, trackState);
+        const summarizeResult = await this.spanSampler.runSpanAsync(
+            { eventName: "SummarizeTree", fullTree },
+            async () => this.summarizerNode.summarize(fullTree, trackState));
         assert(summarizeResult.summary.type === SummaryType.Tree,
             0x12f /* "Container Runtime's summarize should always return a tree" */);
 
@@ -1804,7 +1866,9 @@ export class ContainerRuntime extends TypedEventEmitter<IContainerRuntimeEvents>
 
             let handle: string;
             try {
-                handle = await this.storage.uploadSummaryWithContext(summarizeResult.summary, summaryContext);
+                handle = await this.spanSampler.runSpanAsync(
+                    { eventName: "UploadSummary" },
+                    async () => this.storage.uploadSummaryWithContext(summarizeResult.summary, summaryContext));
             } catch (error) {
                 return { ...attemptData, ...generateData, error };
             }
@@ -268,9 +268,16 @@ export abstract class FluidDataStoreContext extends TypedEventEmitter<IFluidData
         assert(!this.detachedRuntimeCreation, 0x13d /* "Detached runtime creation on realize()" */);
         if (!this.channelDeferred) {
             this.channelDeferred = new Deferred<IFluidDataStoreChannel>();
-            this.realizeCore().catch((error) => {
-                this.channelDeferred?.reject(CreateProcessingError(error, undefined /* message */));
-            });
+            // Timing span covering the load of this data store; no-op unless span telemetry is
+            // enabled on the container runtime.
+            const realizeSpan = this._containerRuntime.spanSampler.startSpan(
+                { eventName: "RealizeDataStore", fluidDataStoreId: this.id });
+            this.realizeCore().then(
+                () => realizeSpan.end(),
+                (error) => {
+                    realizeSpan.cancel(error);
+                    this.channelDeferred?.reject(CreateProcessingError(error, undefined /* message */));
+                });
         }
         return this.channelDeferred.promise;
     }
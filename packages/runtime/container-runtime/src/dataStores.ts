@@ -38,7 +38,7 @@ import {
 import { ChildLogger } from "@fluidframework/telemetry-utils";
 import { AttachState } from "@fluidframework/container-definitions";
 import { BlobCacheStorageService, buildSnapshotTree, readAndParseFromBlobs } from "@fluidframework/driver-utils";
-import { assert, Lazy } from "@fluidframework/common-utils";
+import { assert, Lazy, performance } from "@fluidframework/common-utils";
 import { v4 as uuid } from "uuid";
 import { TreeTreeEntry } from "@fluidframework/protocol-base";
 import { GCDataBuilder, getChildNodesUsedRoutes } from "@fluidframework/garbage-collector";
@@ -398,27 +398,51 @@ export class DataStores implements IDisposable {
         return this.contexts.size;
     }
 
-    public async summarize(fullTree: boolean, trackState: boolean): Promise<IChannelSummarizeResult> {
+    public async summarize(
+        fullTree: boolean,
+        trackState: boolean,
+        yieldThresholdMs?: number,
+    ): Promise<IChannelSummarizeResult> {
         const gcDataBuilder = new GCDataBuilder();
         const summaryBuilder = new SummaryTreeBuilder();
 
-        // Iterate over each store and ask it to snapshot
-        await Promise.all(Array.from(this.contexts)
+        const attachedContexts = Array.from(this.contexts)
             .filter(([_, context]) => {
                 // Summarizer works only with clients with no local changes!
                 assert(context.attachState !== AttachState.Attaching,
                     0x165 /* "Summarizer cannot work if client has local changes" */);
                 return context.attachState === AttachState.Attached;
-            }).map(async ([contextId, context]) => {
-                const contextSummary = await context.summarize(fullTree, trackState);
-                summaryBuilder.addWithStats(contextId, contextSummary);
+            });
 
-                if (contextSummary.gcData !== undefined) {
-                    // Prefix the child's id to the ids of its GC nodest. This gradually builds the id of each node to
-                    // be a path from the root.
-                    gcDataBuilder.prefixAndAddNodes(contextId, contextSummary.gcData.gcNodes);
+        const summarizeContext = async (contextId: string, context: FluidDataStoreContext) => {
+            const contextSummary = await context.summarize(fullTree, trackState);
+            summaryBuilder.addWithStats(contextId, contextSummary);
+
+            if (contextSummary.gcData !== undefined) {
+                // Prefix the child's id to the ids of its GC nodest. This gradually builds the id of each node to
+                // be a path from the root.
+                gcDataBuilder.prefixAndAddNodes(contextId, contextSummary.gcData.gcNodes);
+            }
+        };
+
+        // Iterate over each store and ask it to snapshot
+        if (yieldThresholdMs === undefined) {
+            await Promise.all(attachedContexts.map(async ([contextId, context]) =>
+                summarizeContext(contextId, context)));
+        } else {
+            // Summarizing each context is mostly synchronous work, so a Promise.all over all of them runs as
+            // one long microtask chain that starves the event loop. When the host opts into time-slicing,
+            // summarize sequentially and yield a macrotask whenever we have run past the threshold, letting
+            // timers, socket traffic and signal processing interleave with a large summary.
+            let sliceStart = performance.now();
+            for (const [contextId, context] of attachedContexts) {
+                await summarizeContext(contextId, context);
+                if (performance.now() - sliceStart > yieldThresholdMs) {
+                    await new Promise<void>((resolve) => { setTimeout(resolve, 0); });
+                    sliceStart = performance.now();
                 }
-            }));
+            }
+        }
 
         // Get the outbound routes and add a GC node for this channel.
         gcDataBuilder.addNode("/", await this.getOutboundRoutes());
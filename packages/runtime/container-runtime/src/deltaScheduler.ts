@@ -6,6 +6,7 @@
 import { ITelemetryLogger } from "@fluidframework/common-definitions";
 import { performance } from "@fluidframework/common-utils";
 import { IDeltaManager } from "@fluidframework/container-definitions";
+import { ITelemetrySpan, TelemetrySpanSampler } from "@fluidframework/telemetry-utils";
 import {
     IDocumentMessage,
     ISequencedDocumentMessage,
@@ -49,9 +50,14 @@ export class DeltaScheduler {
         numberOfTurns: number;
     } | undefined;
 
+    // Timing span covering the current turn of inbound queue processing; no-op unless span
+    // telemetry is enabled on the container runtime.
+    private turnSpan: ITelemetrySpan | undefined;
+
     constructor(
         deltaManager: IDeltaManager<ISequencedDocumentMessage, IDocumentMessage>,
         private readonly logger: ITelemetryLogger,
+        private readonly spanSampler?: TelemetrySpanSampler,
     ) {
         this.deltaManager = deltaManager;
         this.deltaManager.inbound.on("idle", () => { this.inboundQueueIdle(); });
@@ -60,6 +66,7 @@ export class DeltaScheduler {
     public batchBegin() {
         if (!this.processingStartTime) {
             this.processingStartTime = performance.now();
+            this.turnSpan = this.spanSampler?.startSpan({ eventName: "InboundQueueTurn" });
         }
     }
 
@@ -91,6 +98,8 @@ export class DeltaScheduler {
                 });
 
                 this.processingStartTime = undefined;
+                this.turnSpan?.end({ opsRemaining: this.deltaManager.inbound.length });
+                this.turnSpan = undefined;
                 // Increase the total processing time. Keep doing this after each turn until all the ops have
                 // been processed. This way we keep the responsiveness at the beginning while also making sure
                 // that all the ops process fairly quickly.
@@ -131,6 +140,8 @@ export class DeltaScheduler {
 
         // Reset the processing times.
         this.processingStartTime = undefined;
+        this.turnSpan?.end({ opsRemaining: 0 });
+        this.turnSpan = undefined;
         this.totalProcessingTime = DeltaScheduler.processingTime;
     }
 
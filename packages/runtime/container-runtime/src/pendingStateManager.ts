@@ -45,6 +45,15 @@ export interface IPendingFlush {
 
 export type IPendingState = IPendingMessage | IPendingFlushMode | IPendingFlush;
 
+/**
+ * Upper bound on the number of replayed messages accumulated into a single batch when resubmitting
+ * pending states on reconnect. Batching the replay keeps per-message flush overhead off the
+ * reconnect path, but a single unbounded batch could exceed the service's frame size limits, so
+ * the accumulated messages are flushed in chunks of this size. Batches that were submitted
+ * manually are never split, since their boundaries carry meaning.
+ */
+export const maxOpsPerReplayedBatch = 100;
+
 export interface IPendingLocalState {
     /**
      * client ID we most recently connected with, or undefined if we never connected
@@ -421,6 +430,16 @@ export class PendingStateManager {
         // Save the current FlushMode so that we can revert it back after replaying the states.
         const savedFlushMode = this.containerRuntime.flushMode;
 
+        // Replay the states in Manual FlushMode so that the resubmitted messages accumulate in the outbound
+        // buffer and are sent as batches instead of one at a time - at high pending-op counts, per-message
+        // flushing dominates reconnect time. The accumulated messages are flushed every
+        // `maxOpsPerReplayedBatch` messages so that no single batch grows without bound, except within a
+        // batch the app submitted manually - those keep their original boundaries.
+        this.containerRuntime.setFlushMode(FlushMode.Manual);
+
+        let opsSinceFlush = 0;
+        let inManualBatch = false;
+
         // Process exactly `pendingStatesCount` items in the queue as it represents the number of states that were
         // pending when we connected. This is important because the `reSubmitFn` might add more items in the queue
         // which must not be replayed.
@@ -435,16 +454,28 @@ export class PendingStateManager {
                             pendingState.content,
                             pendingState.localOpMetadata,
                             pendingState.opMetadata);
+                        opsSinceFlush++;
+                        if (!inManualBatch && opsSinceFlush >= maxOpsPerReplayedBatch) {
+                            this.containerRuntime.flush();
+                            opsSinceFlush = 0;
+                        }
                     }
                     break;
                 case "flushMode":
                     {
-                        this.containerRuntime.setFlushMode(pendingState.flushMode);
+                        // A "flushMode" state marks a boundary of a batch the app submitted manually. Flush
+                        // whatever has accumulated so the manual batch contains exactly its original
+                        // messages, and suspend chunking while inside it. The runtime stays in Manual mode
+                        // either way; the mode is restored once the replay completes.
+                        this.containerRuntime.flush();
+                        opsSinceFlush = 0;
+                        inManualBatch = pendingState.flushMode === FlushMode.Manual;
                     }
                     break;
                 case "flush":
                     {
                         this.containerRuntime.flush();
+                        opsSinceFlush = 0;
                     }
                     break;
                 default:
@@ -453,7 +484,7 @@ export class PendingStateManager {
             pendingStatesCount--;
         }
 
-        // Revert the FlushMode.
+        // Revert the FlushMode. Switching back to Automatic flushes the remaining replayed messages.
         this.containerRuntime.setFlushMode(savedFlushMode);
     }
 }
@@ -39,6 +39,14 @@ export interface ISummarizerClientElectionEvents extends IEvent {
         return this.clientElection.electedClient?.clientId;
     }
 
+    /**
+     * The client that would be elected next if the currently elected client stops summarizing.
+     * Used by SummaryManager to keep a warm standby summarizer on that client.
+     */
+    public get nextElectedClientId() {
+        return this.clientElection.peekNextElectedClient()?.clientId;
+    }
+
     constructor(
         private readonly logger: ITelemetryLogger,
         private readonly summaryCollection: IEventProvider<ISummaryCollectionOpEvents>,
@@ -56,6 +56,7 @@ export class SummaryManager extends EventEmitter implements IDisposable {
         defaultThrottleDelayFunction,
     );
     private opsUntilFirstConnect = -1;
+    private standbySummarizerP?: Promise<ISummarizer>;
 
     public get summarizer() {
         return this.electedClientId;
@@ -71,6 +72,7 @@ export class SummaryManager extends EventEmitter implements IDisposable {
         private readonly summariesEnabled: boolean,
         parentLogger: ITelemetryLogger,
         initialDelayMs: number = defaultInitialDelayMs,
+        private readonly enableWarmStandbySummarizer: boolean = false,
     ) {
         super();
 
@@ -154,6 +156,8 @@ export class SummaryManager extends EventEmitter implements IDisposable {
             this.emit("summarizer", newSummarizerClientId);
         }
 
+        this.updateWarmStandby();
+
         // Transition states depending on shouldSummarize, which is a calculated property
         // that is only true if this client is connected and is the elected summarizer.
         const shouldSummarizeState = this.getShouldSummarizeState();
@@ -209,15 +213,20 @@ export class SummaryManager extends EventEmitter implements IDisposable {
 
         this.state = SummaryManagerState.Starting;
 
+        // A warm standby summarizer may already be loading or loaded from when this client was next in
+        // line for election - promote it instead of booting a new container.
+        const standbyP = this.standbySummarizerP;
+        this.standbySummarizerP = undefined;
+
         // throttle creation of new summarizer containers to prevent spamming the server with websocket connections
         const delayMs = this.startThrottler.getDelay();
-        if (delayMs >= defaultThrottleMaxDelayMs) {
+        if (standbyP === undefined && delayMs >= defaultThrottleMaxDelayMs) {
             // we can't create a summarizer for some reason; raise error on container
             this.raiseContainerWarning(
                 createSummarizingWarning("SummaryManager: CreateSummarizer Max Throttle Delay", false));
         }
 
-        this.createSummarizer(delayMs).then((summarizer) => {
+        (standbyP ?? this.createSummarizer(delayMs)).then((summarizer) => {
             summarizer.on("summarizingError",
                 (warning: ISummarizingWarning) => this.raiseContainerWarning(warning));
             this.run(summarizer);
@@ -326,7 +335,56 @@ export class SummaryManager extends EventEmitter implements IDisposable {
         return summarizer;
     }
 
+    /**
+     * Preloads a summarizer container while this client is next in line for election, so that if the
+     * elected client stops summarizing, failover skips the full container boot. The standby is consumed
+     * by start() when this client becomes elected, and discarded when it is no longer next in line.
+     */
+    private updateWarmStandby() {
+        if (!this.enableWarmStandbySummarizer
+            || !this.summariesEnabled
+            || this.context.clientDetails.type === summarizerClientType) {
+            return;
+        }
+
+        const isNextInLine = this.connected
+            && this.clientId !== undefined
+            && this.clientId === this.clientElection.nextElectedClientId
+            && this.clientId !== this.electedClientId;
+
+        if (isNextInLine) {
+            if (this.standbySummarizerP === undefined) {
+                this.logger.sendTelemetryEvent({ eventName: "WarmStandbySummarizerStarting" });
+                const standbyP = this.createSummarizer(0 /* delayMs */);
+                this.standbySummarizerP = standbyP;
+                standbyP.catch(() => {
+                    if (this.standbySummarizerP === standbyP) {
+                        this.standbySummarizerP = undefined;
+                    }
+                });
+            }
+        } else if (this.clientId !== this.electedClientId) {
+            this.discardStandbySummarizer();
+        }
+    }
+
+    private discardStandbySummarizer() {
+        const standbyP = this.standbySummarizerP;
+        if (standbyP === undefined) {
+            return;
+        }
+        this.standbySummarizerP = undefined;
+        this.logger.sendTelemetryEvent({ eventName: "WarmStandbySummarizerDiscarded" });
+        standbyP.then((summarizer) => {
+            // Stop before run: run() then refuses to summarize (this client is not the computed
+            // summarizer) and closes the standby container on its way out.
+            summarizer.stop("parentShouldNotSummarize");
+            summarizer.run(this.latestClientId ?? "").catch(() => {});
+        }).catch(() => {});
+    }
+
     public dispose() {
+        this.discardStandbySummarizer();
         this.initialDelayTimer?.clear();
         this._disposed = true;
     }
@@ -0,0 +1,111 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { EventEmitter } from "events";
+import { Deferred, IsoBuffer } from "@fluidframework/common-utils";
+import { IFluidHandleContext } from "@fluidframework/core-interfaces";
+import { IDocumentStorageService } from "@fluidframework/driver-definitions";
+import { AttachState } from "@fluidframework/container-definitions";
+import { IContainerRuntime } from "@fluidframework/container-runtime-definitions";
+import { MockLogger } from "@fluidframework/test-runtime-utils";
+import { BlobManager } from "../blobManager";
+
+const mockHandleContext: IFluidHandleContext = {
+    absolutePath: "",
+    isAttached: false,
+    IFluidHandleContext: undefined as any,
+
+    attachGraph: () => {
+        throw new Error("Method not implemented.");
+    },
+    resolveHandle: () => {
+        throw new Error("Method not implemented.");
+    },
+};
+
+class MockStorage {
+    public createBlobCalls = 0;
+    public inFlight = 0;
+    public maxInFlight = 0;
+    // When set, createBlob() waits on this before resolving, so tests can control upload timing.
+    public uploadGate: Deferred<void> | undefined;
+    private readonly blobs: Map<string, ArrayBufferLike> = new Map();
+
+    public async createBlob(blob: ArrayBufferLike) {
+        this.createBlobCalls++;
+        this.inFlight++;
+        this.maxInFlight = Math.max(this.maxInFlight, this.inFlight);
+        await this.uploadGate?.promise;
+        this.inFlight--;
+        const id = `blob-${this.blobs.size}`;
+        this.blobs.set(id, blob);
+        return { id };
+    }
+
+    public async readBlob(id: string): Promise<ArrayBufferLike> {
+        const blob = this.blobs.get(id);
+        assert(blob !== undefined, "reading unknown blob");
+        return blob;
+    }
+}
+
+describe("BlobManager", () => {
+    let storage: MockStorage;
+    let blobManager: BlobManager;
+    let attachedBlobIds: string[];
+
+    beforeEach(() => {
+        storage = new MockStorage();
+        attachedBlobIds = [];
+        const mockRuntime = new EventEmitter() as unknown as IContainerRuntime;
+        (mockRuntime as any).attachState = AttachState.Attached;
+        blobManager = new BlobManager(
+            mockHandleContext,
+            () => storage as unknown as IDocumentStorageService,
+            (blobId) => {
+                attachedBlobIds.push(blobId);
+                // Simulate the blob attach op round trip completing immediately.
+                blobManager.processBlobAttachOp(blobId, true);
+            },
+            mockRuntime,
+            new MockLogger(),
+        );
+    });
+
+    it("uploads identical content only once and reuses the storage ID", async () => {
+        const content = IsoBuffer.from("same content");
+        const handle1 = await blobManager.createBlob(content);
+        const handle2 = await blobManager.createBlob(IsoBuffer.from("same content"));
+        assert.strictEqual(storage.createBlobCalls, 1, "identical content should be uploaded once");
+        assert.strictEqual(handle1.absolutePath, handle2.absolutePath);
+        assert.strictEqual(attachedBlobIds.length, 1, "only one blob attach op expected");
+    });
+
+    it("uploads distinct content separately", async () => {
+        await blobManager.createBlob(IsoBuffer.from("content one"));
+        await blobManager.createBlob(IsoBuffer.from("content two"));
+        assert.strictEqual(storage.createBlobCalls, 2);
+        assert.strictEqual(blobManager.blobCount, 2);
+    });
+
+    it("bounds upload concurrency", async () => {
+        storage.uploadGate = new Deferred<void>();
+        const blobCount = 6;
+        const createPs: Promise<unknown>[] = [];
+        for (let i = 0; i < blobCount; i++) {
+            createPs.push(blobManager.createBlob(IsoBuffer.from(`unique content ${i}`)));
+        }
+        // Let the hashing and upload scheduling microtasks run.
+        while (storage.createBlobCalls < 4) {
+            await Promise.resolve();
+        }
+        assert.strictEqual(storage.inFlight, 4, "only 4 uploads should be in flight");
+        storage.uploadGate.resolve();
+        await Promise.all(createPs);
+        assert.strictEqual(storage.createBlobCalls, blobCount, "all uploads should complete");
+        assert.strictEqual(storage.maxInFlight, 4, "concurrency should stay bounded");
+    });
+});
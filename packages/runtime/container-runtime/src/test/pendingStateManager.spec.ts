@@ -0,0 +1,145 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { FlushMode } from "@fluidframework/runtime-definitions";
+import { ContainerMessageType, ContainerRuntime } from "../containerRuntime";
+import { maxOpsPerReplayedBatch, PendingStateManager } from "../pendingStateManager";
+
+/**
+ * Mimics the parts of the ContainerRuntime that the PendingStateManager interacts with during
+ * replay: submission accumulates messages into an outbound buffer in Manual FlushMode, every
+ * flush sends the buffered messages as one batch, and state changes are reported back to the
+ * PendingStateManager just like the real runtime does.
+ */
+class MockContainerRuntimeForReplay {
+    public flushMode = FlushMode.Automatic;
+    public clientId = "newClientId";
+    public readonly connected = true;
+    public pendingStateManager: PendingStateManager | undefined;
+
+    // The sizes of the batches sent so far, in order.
+    public readonly batchSizes: number[] = [];
+
+    private bufferedMessageCount = 0;
+    private clientSequenceNumber = 0;
+
+    public setFlushMode(mode: FlushMode): void {
+        if (mode === this.flushMode) {
+            return;
+        }
+        if (mode === FlushMode.Automatic) {
+            this.flush();
+        }
+        this.flushMode = mode;
+        this.pendingStateManager?.onFlushModeUpdated(mode);
+    }
+
+    public flush(): void {
+        this.pendingStateManager?.onFlush();
+        if (this.bufferedMessageCount > 0) {
+            this.batchSizes.push(this.bufferedMessageCount);
+            this.bufferedMessageCount = 0;
+        }
+    }
+
+    public readonly reSubmitFn = (
+        messageType: ContainerMessageType,
+        content: any,
+        localOpMetadata: unknown,
+        opMetadata: Record<string, unknown> | undefined,
+    ): void => {
+        this.bufferedMessageCount++;
+        this.pendingStateManager?.onSubmitMessage(
+            messageType, this.clientSequenceNumber++, 0, content, localOpMetadata, opMetadata);
+        if (this.flushMode === FlushMode.Automatic) {
+            this.flush();
+        }
+    };
+}
+
+describe("PendingStateManager", () => {
+    describe("replayPendingStates batching", () => {
+        let mockRuntime: MockContainerRuntimeForReplay;
+        let pendingStateManager: PendingStateManager;
+
+        beforeEach(() => {
+            mockRuntime = new MockContainerRuntimeForReplay();
+            pendingStateManager = new PendingStateManager(
+                mockRuntime as unknown as ContainerRuntime,
+                async () => undefined,
+                undefined /* initialState */,
+            );
+            mockRuntime.pendingStateManager = pendingStateManager;
+        });
+
+        const submitPendingMessages = (count: number) => {
+            for (let i = 0; i < count; i++) {
+                pendingStateManager.onSubmitMessage(
+                    ContainerMessageType.FluidDataStoreOp, i, 0, { id: i }, undefined, undefined);
+            }
+        };
+
+        it("batches replayed messages instead of sending them one at a time", () => {
+            submitPendingMessages(10);
+
+            pendingStateManager.replayPendingStates();
+
+            assert.deepStrictEqual(mockRuntime.batchSizes, [10], "replay should send a single batch");
+            assert.strictEqual(mockRuntime.flushMode, FlushMode.Automatic, "FlushMode should be restored");
+        });
+
+        it("flushes in bounded chunks when there are many pending messages", () => {
+            submitPendingMessages(maxOpsPerReplayedBatch * 2 + 50);
+
+            pendingStateManager.replayPendingStates();
+
+            assert.deepStrictEqual(
+                mockRuntime.batchSizes,
+                [maxOpsPerReplayedBatch, maxOpsPerReplayedBatch, 50],
+                "no replayed batch should exceed the cap");
+        });
+
+        it("preserves the boundaries of a manually flushed batch", () => {
+            submitPendingMessages(5);
+            mockRuntime.setFlushMode(FlushMode.Manual);
+            submitPendingMessages(3);
+            mockRuntime.setFlushMode(FlushMode.Automatic);
+            submitPendingMessages(4);
+
+            pendingStateManager.replayPendingStates();
+
+            assert.deepStrictEqual(
+                mockRuntime.batchSizes, [5, 3, 4],
+                "the manual batch should contain exactly its original messages");
+        });
+
+        it("does not split a manual batch larger than the chunk cap", () => {
+            mockRuntime.setFlushMode(FlushMode.Manual);
+            submitPendingMessages(maxOpsPerReplayedBatch + 10);
+            mockRuntime.setFlushMode(FlushMode.Automatic);
+
+            pendingStateManager.replayPendingStates();
+
+            assert.deepStrictEqual(
+                mockRuntime.batchSizes, [maxOpsPerReplayedBatch + 10],
+                "a manual batch is atomic regardless of its size");
+        });
+
+        it("replays manual flushes between batches", () => {
+            mockRuntime.setFlushMode(FlushMode.Manual);
+            submitPendingMessages(2);
+            mockRuntime.flush();
+            submitPendingMessages(3);
+            mockRuntime.setFlushMode(FlushMode.Automatic);
+
+            pendingStateManager.replayPendingStates();
+
+            assert.deepStrictEqual(
+                mockRuntime.batchSizes, [2, 3],
+                "each manually flushed batch should be replayed separately");
+        });
+    });
+});
@@ -0,0 +1,54 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { IGarbageCollectionData } from "@fluidframework/runtime-definitions";
+import { GCDataBuilder, shallowCloneGCData } from "../utils";
+
+describe("Garbage Collection Utils", () => {
+    describe("shallowCloneGCData", () => {
+        it("returns a new nodes map that shares the outbound routes arrays", () => {
+            const gcData: IGarbageCollectionData = {
+                gcNodes: {
+                    "/": [ "/node1" ],
+                    "/node1": [ "/node2", "/node3" ],
+                },
+            };
+
+            const clone = shallowCloneGCData(gcData);
+            assert.deepStrictEqual(clone, gcData, "The clone should have the same nodes and routes");
+            assert.notStrictEqual(clone.gcNodes, gcData.gcNodes, "The nodes map should be a copy");
+            assert.strictEqual(
+                clone.gcNodes["/node1"], gcData.gcNodes["/node1"], "The routes arrays should be shared");
+
+            // Adding a node to the clone should not be visible in the original.
+            clone.gcNodes["/node4"] = [];
+            assert.strictEqual(gcData.gcNodes["/node4"], undefined, "The original nodes map should be unchanged");
+        });
+    });
+
+    describe("GCDataBuilder", () => {
+        it("addRouteToAllNodes does not mutate the given routes arrays", () => {
+            // The routes arrays added to the builder may be shared with caches (such as the summarizer node's
+            // cached GC data), so adding a route must not update them in place.
+            const node1Routes = [ "/node2" ];
+            const node2Routes: string[] = [];
+
+            const builder = new GCDataBuilder();
+            builder.addNode("/node1", node1Routes);
+            builder.prefixAndAddNodes("prefix", { "/node2": node2Routes });
+            builder.addRouteToAllNodes("/backRoute");
+
+            assert.deepStrictEqual(node1Routes, [ "/node2" ], "The added routes array should be unchanged");
+            assert.deepStrictEqual(node2Routes, [], "The prefixed routes array should be unchanged");
+            assert.deepStrictEqual(builder.getGCData(), {
+                gcNodes: {
+                    "/node1": [ "/node2", "/backRoute" ],
+                    "/prefix/node2": [ "/backRoute" ],
+                },
+            }, "The builder's nodes should have the added route");
+        });
+    });
+});
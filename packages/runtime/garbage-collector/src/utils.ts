@@ -21,6 +21,20 @@ export function cloneGCData(gcData: IGarbageCollectionData): IGarbageCollectionD
     };
 }
 
+/**
+ * Helper function that creates a shallow view of the GC data - the returned GC data has a new nodes map but the
+ * outbound routes arrays are shared with the given GC data. Use this instead of cloneGCData when the routes are
+ * not going to be mutated, such as when returning cached GC data. Copying just the map keeps unchanged nodes from
+ * costing a full copy of their routes on every GC run.
+ * @param gcData - The GC data to copy.
+ * @returns a shallow copy of the given GC data.
+ */
+export function shallowCloneGCData(gcData: IGarbageCollectionData): IGarbageCollectionData {
+    return {
+        gcNodes: { ...gcData.gcNodes },
+    };
+}
+
 /**
  * Helper function that generates the used routes of children from a given node's used routes.
  * @param usedRoutes - The used routes of a node.
@@ -122,11 +136,13 @@ export class GCDataBuilder implements IGarbageCollectionData {
     }
 
     /**
-     * Adds the given outbound route to the outbound routes of all GC nodes.
+     * Adds the given outbound route to the outbound routes of all GC nodes. The outbound routes arrays may be
+     * shared with the caches in the summarizer nodes that provided them, so replace them with extended copies
+     * instead of mutating them in place.
      */
     public addRouteToAllNodes(outboundRoute: string) {
-        for (const outboundRoutes of Object.values(this.gcNodes)) {
-            outboundRoutes.push(outboundRoute);
+        for (const [id, outboundRoutes] of Object.entries(this.gcNodes)) {
+            this.gcNodes[id] = [ ...outboundRoutes, outboundRoute ];
         }
     }
 
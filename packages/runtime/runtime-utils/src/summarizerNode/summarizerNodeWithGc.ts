@@ -5,7 +5,7 @@
 
 import { ITelemetryLogger } from "@fluidframework/common-definitions";
 import { assert, LazyPromise } from "@fluidframework/common-utils";
-import { cloneGCData } from "@fluidframework/garbage-collector";
+import { cloneGCData, shallowCloneGCData } from "@fluidframework/garbage-collector";
 import { ISnapshotTree } from "@fluidframework/protocol-definitions";
 import {
     CreateChildSummarizerNodeParam,
@@ -160,7 +160,9 @@ export class SummarizerNodeWithGC extends SummarizerNode implements IRootSummari
 
             // If there is no cached GC data, return empty data in summarize result. It is the caller's responsibility
             // to ensure that GC data is available by calling getGCData before calling summarize.
-            const gcData = this.gcData !== undefined ? cloneGCData(this.gcData) : { gcNodes: {} };
+            // The returned routes are only read by consumers (GCDataBuilder extends them copy-on-write), so a
+            // shallow copy is enough to protect the cache.
+            const gcData = this.gcData !== undefined ? shallowCloneGCData(this.gcData) : { gcNodes: {} };
 
             return {
                 ...summarizeResult,
@@ -195,8 +197,10 @@ export class SummarizerNodeWithGC extends SummarizerNode implements IRootSummari
         // If there is no new data since last summary and we have GC data from the previous run, return it. We may not
         // have data from previous GC run for clients with older summary format before GC was added. They won't have
         // GC details in their initial summary.
+        // A shallow copy makes this cache hit O(nodes) instead of O(routes) - consumers only read the route arrays,
+        // so sharing them with the cache is safe.
         if (!fullGC && !this.hasDataChanged() && this.gcData !== undefined) {
-            return cloneGCData(this.gcData);
+            return shallowCloneGCData(this.gcData);
         }
 
         const gcData = await this.getGCDataFn(fullGC);
@@ -0,0 +1,57 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import fs from "fs";
+import commander from "commander";
+import { runScenarios } from "./runner";
+import { scenarios } from "./scenarios";
+
+async function main() {
+    commander
+        .version("0.0.1")
+        .option("-f, --filter <substring>", "Only run scenarios whose name contains the given substring")
+        .option("-r, --runs <number>", "Number of timed runs per scenario", "10")
+        .option("-w, --warmup <number>", "Number of untimed warmup runs per scenario", "2")
+        .option("-o, --output <path>", "Write results as JSON to the given path for regression tracking")
+        .option("--list", "List available scenarios and exit")
+        .parse(process.argv);
+
+    const filter: string | undefined = commander.filter;
+    const runs: number = parseInt(commander.runs, 10);
+    const warmupRuns: number = parseInt(commander.warmup, 10);
+    const output: string | undefined = commander.output;
+
+    if (commander.list === true) {
+        for (const scenario of scenarios) {
+            console.log(scenario.name);
+        }
+        return;
+    }
+
+    const selected = filter === undefined
+        ? scenarios
+        : scenarios.filter((scenario) => scenario.name.includes(filter));
+
+    if (selected.length === 0) {
+        console.error(`No scenarios match filter: ${filter}`);
+        process.exit(1);
+    }
+
+    if (typeof global.gc !== "function") {
+        console.warn("Warning: run with --expose-gc for more stable timings.");
+    }
+
+    const report = await runScenarios(selected, { runs, warmupRuns });
+
+    if (output !== undefined) {
+        fs.writeFileSync(output, `${JSON.stringify(report, undefined, 4)}\n`);
+        console.log(`Results written to ${output}`);
+    }
+}
+
+main().catch((error) => {
+    console.error(error);
+    process.exit(-1);
+});
@@ -0,0 +1,134 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+/**
+ * A single benchmark scenario.  'setup()' runs untimed before every run (including warmup
+ * runs) and produces fresh state; 'run()' is the timed body.  'iterations' is the number
+ * of logical operations a single run performs, used to derive an ops/second figure.
+ */
+export interface IScenario<T = unknown> {
+    name: string;
+    iterations: number;
+    setup: () => T | Promise<T>;
+    run: (state: T) => void | Promise<void>;
+}
+
+export interface IScenarioResult {
+    name: string;
+    runs: number;
+    iterations: number;
+    meanMs: number;
+    medianMs: number;
+    stdDevMs: number;
+    p95Ms: number;
+    opsPerSecond: number;
+}
+
+export interface IBenchmarkReport {
+    timestamp: string;
+    nodeVersion: string;
+    warmupRuns: number;
+    results: IScenarioResult[];
+}
+
+export interface IRunnerOptions {
+    /** Number of timed runs per scenario (excluding warmup). */
+    runs: number;
+    /** Number of untimed warmup runs per scenario. */
+    warmupRuns: number;
+}
+
+let count = 0;
+let cached: any;
+
+/**
+ * Paranoid defense against dead code elimination.
+ */
+export function consume(value: any) {
+    count++;
+    // eslint-disable-next-line no-bitwise
+    if ((count >>> 0) === 0) {
+        cached = value;
+    }
+}
+
+// Prevent v8's optimizer from identifying 'cached' as an unused value.
+process.on("exit", () => {
+    // eslint-disable-next-line no-bitwise
+    if ((count >>> 0) === 0) {
+        console.log(`Ignore this: ${cached}`);
+    }
+});
+
+function computeStats(samplesMs: number[], iterations: number) {
+    const sorted = [...samplesMs].sort((left, right) => left - right);
+    const mean = samplesMs.reduce((sum, sample) => sum + sample, 0) / samplesMs.length;
+    const variance =
+        samplesMs.reduce((sum, sample) => sum + (sample - mean) ** 2, 0) / samplesMs.length;
+
+    return {
+        meanMs: mean,
+        medianMs: sorted[Math.floor(sorted.length / 2)],
+        stdDevMs: Math.sqrt(variance),
+        p95Ms: sorted[Math.min(sorted.length - 1, Math.ceil(sorted.length * 0.95) - 1)],
+        opsPerSecond: iterations / (mean / 1000),
+    };
+}
+
+export async function runScenario<T>(
+    scenario: IScenario<T>,
+    options: IRunnerOptions,
+): Promise<IScenarioResult> {
+    const samplesMs: number[] = [];
+
+    for (let run = 0; run < options.warmupRuns + options.runs; run++) {
+        const state = await scenario.setup();
+
+        // Give each run as level a playing field as the host allows (requires --expose-gc).
+        if (typeof global.gc === "function") {
+            global.gc();
+        }
+
+        const start = process.hrtime.bigint();
+        await scenario.run(state);
+        const elapsedMs = Number(process.hrtime.bigint() - start) / 1e6;
+
+        consume(state);
+
+        if (run >= options.warmupRuns) {
+            samplesMs.push(elapsedMs);
+        }
+    }
+
+    return {
+        name: scenario.name,
+        runs: options.runs,
+        iterations: scenario.iterations,
+        ...computeStats(samplesMs, scenario.iterations),
+    };
+}
+
+export async function runScenarios(
+    scenarios: Iterable<IScenario<any>>,
+    options: IRunnerOptions,
+): Promise<IBenchmarkReport> {
+    const results: IScenarioResult[] = [];
+
+    for (const scenario of scenarios) {
+        const result = await runScenario(scenario, options);
+        results.push(result);
+
+        console.log(`${result.name}: ${result.meanMs.toFixed(2)}ms avg`
+            + ` (±${result.stdDevMs.toFixed(2)}ms, p95 ${result.p95Ms.toFixed(2)}ms,`
+            + ` ${Math.round(result.opsPerSecond).toLocaleString()} ops/s)`);
+    }
+
+    return {
+        timestamp: new Date().toISOString(),
+        nodeVersion: process.version,
+        warmupRuns: options.warmupRuns,
+        results,
+    };
+}
@@ -0,0 +1,185 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { IChannelServices } from "@fluidframework/datastore-definitions";
+import { MapFactory, SharedMap } from "@fluidframework/map";
+import { SharedMatrix, SharedMatrixFactory } from "@fluidframework/matrix";
+import { SharedString, SharedStringFactory } from "@fluidframework/sequence";
+import {
+    MockContainerRuntimeFactory,
+    MockEmptyDeltaConnection,
+    MockFluidDataStoreRuntime,
+    MockStorage,
+} from "@fluidframework/test-runtime-utils";
+import { IScenario } from "./runner";
+
+/**
+ * Deterministic PRNG (mulberry32) so that "random" edit replays are identical
+ * across runs and across versions under comparison.
+ */
+function makeRandom(seed: number) {
+    let state = seed;
+    return () => {
+        // eslint-disable-next-line no-bitwise
+        state |= 0; state = (state + 0x6d2b79f5) | 0;
+        // eslint-disable-next-line no-bitwise
+        let t = Math.imul(state ^ (state >>> 15), 1 | state);
+        // eslint-disable-next-line no-bitwise
+        t = (t + Math.imul(t ^ (t >>> 7), 61 | t)) ^ t;
+        // eslint-disable-next-line no-bitwise
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+}
+
+function createLocalString(id: string) {
+    return new SharedString(new MockFluidDataStoreRuntime(), id, SharedStringFactory.Attributes);
+}
+
+function createLocalMap(id: string) {
+    return new SharedMap(id, new MockFluidDataStoreRuntime(), MapFactory.Attributes);
+}
+
+function createLocalMatrix(id: string) {
+    return new SharedMatrix(new MockFluidDataStoreRuntime(), id, SharedMatrixFactory.Attributes);
+}
+
+function createConnectedMap(id: string, runtimeFactory: MockContainerRuntimeFactory) {
+    const dataStoreRuntime = new MockFluidDataStoreRuntime();
+    const containerRuntime = runtimeFactory.createContainerRuntime(dataStoreRuntime);
+    const services: IChannelServices = {
+        deltaConnection: containerRuntime.createDeltaConnection(),
+        objectStorage: new MockStorage(),
+    };
+    const map = new SharedMap(id, dataStoreRuntime, MapFactory.Attributes);
+    map.connect(services);
+    return map;
+}
+
+function populateString(sharedString: SharedString, length: number) {
+    // Insert in chunks so the merge-tree contains many segments, as it would after
+    // a real editing session, rather than one giant segment.
+    for (let pos = 0; pos < length; pos += 10) {
+        sharedString.insertText(pos, "0123456789");
+    }
+}
+
+const typingIterations = 10_000;
+const mapIterations = 10_000;
+const matrixDimension = 256;
+const summaryStringLength = 100_000;
+
+export const scenarios: IScenario<any>[] = [
+    {
+        name: "sharedString: sequential typing",
+        iterations: typingIterations,
+        setup: () => createLocalString("bench-typing"),
+        run: (sharedString: SharedString) => {
+            for (let i = 0; i < typingIterations; i++) {
+                sharedString.insertText(i, "x");
+            }
+        },
+    },
+    {
+        name: "sharedString: random-position typing replay",
+        iterations: typingIterations,
+        setup: () => createLocalString("bench-typing-random"),
+        run: (sharedString: SharedString) => {
+            const random = makeRandom(0xb1a5);
+            for (let i = 0; i < typingIterations; i++) {
+                sharedString.insertText(Math.floor(random() * (i + 1)), "x");
+            }
+        },
+    },
+    {
+        name: "sharedString: remove sweep",
+        iterations: typingIterations,
+        setup: () => {
+            const sharedString = createLocalString("bench-remove");
+            populateString(sharedString, typingIterations);
+            return sharedString;
+        },
+        run: (sharedString: SharedString) => {
+            for (let i = 0; i < typingIterations; i++) {
+                sharedString.removeText(0, 1);
+            }
+        },
+    },
+    {
+        name: `sharedString: summarize ${summaryStringLength} chars`,
+        iterations: 1,
+        setup: () => {
+            const sharedString = createLocalString("bench-summarize");
+            populateString(sharedString, summaryStringLength);
+            return sharedString;
+        },
+        run: (sharedString: SharedString) => {
+            sharedString.summarize();
+        },
+    },
+    {
+        name: `sharedString: load ${summaryStringLength} chars from summary (boot)`,
+        iterations: 1,
+        setup: () => {
+            const sharedString = createLocalString("bench-boot-source");
+            populateString(sharedString, summaryStringLength);
+            const services: IChannelServices = {
+                deltaConnection: new MockEmptyDeltaConnection(),
+                objectStorage: MockStorage.createFromSummary(sharedString.summarize().summary),
+            };
+            return services;
+        },
+        run: async (services: IChannelServices) => {
+            const sharedString = new SharedString(
+                new MockFluidDataStoreRuntime(), "bench-boot", SharedStringFactory.Attributes);
+            await sharedString.load(services);
+            await sharedString.loaded;
+        },
+    },
+    {
+        name: "sharedMap: set keys",
+        iterations: mapIterations,
+        setup: () => createLocalMap("bench-map-set"),
+        run: (map: SharedMap) => {
+            for (let i = 0; i < mapIterations; i++) {
+                map.set(`key${i}`, i);
+            }
+        },
+    },
+    {
+        name: "sharedMap: remote op application",
+        iterations: mapIterations,
+        setup: () => {
+            // Submit the ops up front so the timed body measures applying the
+            // sequenced ops on the second client, not generating them.
+            const runtimeFactory = new MockContainerRuntimeFactory();
+            const sender = createConnectedMap("bench-map-sender", runtimeFactory);
+            createConnectedMap("bench-map-receiver", runtimeFactory);
+            for (let i = 0; i < mapIterations; i++) {
+                sender.set(`key${i}`, i);
+            }
+            return runtimeFactory;
+        },
+        run: (runtimeFactory: MockContainerRuntimeFactory) => {
+            runtimeFactory.processAllMessages();
+        },
+    },
+    {
+        name: `sharedMatrix: ${matrixDimension}x${matrixDimension} bulk set`,
+        iterations: matrixDimension * matrixDimension,
+        setup: () => {
+            const matrix = createLocalMatrix("bench-matrix");
+            matrix.insertRows(0, matrixDimension);
+            matrix.insertCols(0, matrixDimension);
+            return matrix;
+        },
+        run: (matrix: SharedMatrix) => {
+            for (let row = 0; row < matrixDimension; row++) {
+                for (let col = 0; col < matrixDimension; col++) {
+                    matrix.setCell(row, col, row * matrixDimension + col);
+                }
+            }
+        },
+    },
+];
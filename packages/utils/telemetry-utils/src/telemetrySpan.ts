@@ -0,0 +1,171 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import {
+    ITelemetryGenericEvent,
+    ITelemetryLogger,
+    ITelemetryProperties,
+} from "@fluidframework/common-definitions";
+import { performance } from "@fluidframework/common-utils";
+
+/**
+ * A timing span handed out by {@link TelemetrySpanSampler}.  Callers must call either 'end()'
+ * or 'cancel()' exactly once.  Unsampled spans are represented by a shared no-op instance, so
+ * callers never need to branch on whether a span was actually recorded.
+ */
+export interface ITelemetrySpan {
+    end(props?: ITelemetryProperties): void;
+    cancel(error?: any): void;
+}
+
+const nullSpan: ITelemetrySpan = {
+    end: () => {},
+    cancel: () => {},
+};
+
+class TelemetrySpan implements ITelemetrySpan {
+    private readonly startTime = performance.now();
+    private done = false;
+
+    constructor(
+        private readonly sampler: TelemetrySpanSampler,
+        public readonly id: number,
+        private readonly parentId: number | undefined,
+        private readonly event: ITelemetryGenericEvent,
+    ) {}
+
+    public end(props?: ITelemetryProperties): void {
+        this.report(props);
+    }
+
+    public cancel(error?: any): void {
+        this.report(undefined, error);
+    }
+
+    private report(props?: ITelemetryProperties, error?: any): void {
+        // Guard against double reporting; same motivation as PerformanceEvent.reportEvent.
+        if (this.done) {
+            return;
+        }
+        this.done = true;
+        this.sampler.reportSpan(
+            {
+                ...this.event,
+                ...props,
+                // Cancelled spans surface as errors, like cancelled PerformanceEvents.
+                category: error === undefined ? this.event.category : "error",
+                duration: performance.now() - this.startTime,
+                spanId: this.id,
+                parentSpanId: this.parentId,
+            },
+            error);
+    }
+}
+
+/**
+ * Produces flamegraph-style timing spans and emits them as performance events through the
+ * given logger.  Spans carry a spanId and (for nested spans) a parentSpanId so that emitted
+ * events can be reassembled into a tree showing where time went within a sampled operation.
+ *
+ * Two entry points:
+ *
+ * * 'runSampledSpan()' starts a root span for a hot, frequent operation (e.g. processing an
+ *   inbound op).  Only 1-in-'sampleRate' such roots are recorded; the rest cost a counter
+ *   increment and a comparison.
+ *
+ * * 'startSpan()' records a span for infrequent operations (e.g. summary generation, data
+ *   store realization) whenever the sampler is enabled.  If it is called while a sampled
+ *   span is open, the new span becomes its child, keeping the recorded tree coherent.
+ *
+ * A 'sampleRate' of 0 (the default) disables the sampler entirely; both entry points then
+ * return a shared no-op span / invoke the callback directly, so there is no per-call
+ * allocation or logging on hot paths.
+ */
+export class TelemetrySpanSampler {
+    private nextSpanId = 0;
+    private rootCount = 0;
+    private currentSpan: TelemetrySpan | undefined;
+
+    constructor(
+        private readonly logger: ITelemetryLogger,
+        private readonly sampleRate: number = 0,
+    ) {}
+
+    public get enabled(): boolean {
+        return this.sampleRate > 0;
+    }
+
+    /**
+     * Starts a span for an infrequent operation.  Recorded whenever the sampler is enabled;
+     * nested under the currently open sampled span, if there is one.  The caller must end or
+     * cancel the returned span (spans may outlive the current turn, e.g. for async work).
+     */
+    public startSpan(event: ITelemetryGenericEvent): ITelemetrySpan {
+        if (!this.enabled) {
+            return nullSpan;
+        }
+        return new TelemetrySpan(this, this.nextSpanId++, this.currentSpan?.id, event);
+    }
+
+    /**
+     * Runs 'callback' under a root span for a hot, frequent operation, recording only
+     * 1-in-'sampleRate' invocations.  While a recorded root is open, every 'startSpan()' /
+     * 'runSampledSpan()' call within the callback's synchronous extent is recorded as a
+     * child span.
+     */
+    public runSampledSpan<T>(event: ITelemetryGenericEvent, callback: () => T): T {
+        if (!this.enabled) {
+            return callback();
+        }
+
+        // Children of an open sampled span are always recorded, so that a sampled operation
+        // produces a complete tree; otherwise apply 1-in-N sampling.
+        if (this.currentSpan === undefined && this.rootCount++ % this.sampleRate !== 0) {
+            return callback();
+        }
+
+        const span = new TelemetrySpan(this, this.nextSpanId++, this.currentSpan?.id, event);
+        const previousSpan = this.currentSpan;
+        this.currentSpan = span;
+        try {
+            const result = callback();
+            span.end();
+            return result;
+        } catch (error) {
+            span.cancel(error);
+            throw error;
+        } finally {
+            this.currentSpan = previousSpan;
+        }
+    }
+
+    /**
+     * Runs an async 'callback' under a span, recorded whenever the sampler is enabled.  The
+     * parent relationship is captured at start time; the span does not act as parent for
+     * unrelated work interleaved while the callback is awaiting.
+     */
+    public async runSpanAsync<T>(event: ITelemetryGenericEvent, callback: () => Promise<T>): Promise<T> {
+        if (!this.enabled) {
+            return callback();
+        }
+
+        const span = this.startSpan(event);
+        try {
+            const result = await callback();
+            span.end();
+            return result;
+        } catch (error) {
+            span.cancel(error);
+            throw error;
+        }
+    }
+
+    /**
+     * Used by spans to report themselves; not intended for direct use.
+     */
+    public reportSpan(event: ITelemetryGenericEvent & { duration: number }, error?: any): void {
+        this.logger.sendPerformanceEvent(event, error);
+    }
+}
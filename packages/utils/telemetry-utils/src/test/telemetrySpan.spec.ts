@@ -0,0 +1,134 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { strict as assert } from "assert";
+import { ITelemetryBaseEvent, ITelemetryBaseLogger } from "@fluidframework/common-definitions";
+import { ChildLogger } from "../logger";
+import { TelemetrySpanSampler } from "../telemetrySpan";
+
+describe("TelemetrySpanSampler", () => {
+    let events: ITelemetryBaseEvent[];
+
+    function createSampler(sampleRate: number) {
+        const baseLogger: ITelemetryBaseLogger = {
+            send(event: ITelemetryBaseEvent): void {
+                events.push(event);
+            },
+        };
+        return new TelemetrySpanSampler(ChildLogger.create(baseLogger), sampleRate);
+    }
+
+    beforeEach(() => {
+        events = [];
+    });
+
+    it("records nothing when disabled", () => {
+        const sampler = createSampler(0);
+        assert.equal(sampler.enabled, false);
+
+        sampler.runSampledSpan({ eventName: "root" }, () => {
+            sampler.startSpan({ eventName: "child" }).end();
+        });
+
+        assert.equal(events.length, 0);
+    });
+
+    it("records 1-in-N sampled roots", () => {
+        const sampler = createSampler(3);
+
+        for (let i = 0; i < 9; i++) {
+            sampler.runSampledSpan({ eventName: "root" }, () => {});
+        }
+
+        assert.equal(events.length, 3);
+        for (const event of events) {
+            assert.equal(event.eventName, "root");
+            assert(typeof event.duration === "number");
+        }
+    });
+
+    it("records children of a sampled root with parentSpanId", () => {
+        const sampler = createSampler(1);
+
+        sampler.runSampledSpan({ eventName: "root" }, () => {
+            sampler.startSpan({ eventName: "child" }).end();
+        });
+
+        // Children end before their parent, so the child event is emitted first.
+        assert.equal(events.length, 2);
+        const [child, root] = events;
+        assert.equal(child.eventName, "child");
+        assert.equal(root.eventName, "root");
+        assert.equal(child.parentSpanId, root.spanId);
+        assert.equal(root.parentSpanId, undefined);
+    });
+
+    it("always records children while an unsampled interval elapses between roots", () => {
+        const sampler = createSampler(2);
+
+        // First root sampled, second not; children outside any root are still recorded.
+        sampler.runSampledSpan({ eventName: "root" }, () => {});
+        sampler.runSampledSpan({ eventName: "root" }, () => {});
+        sampler.startSpan({ eventName: "standalone" }).end();
+
+        assert.deepEqual(events.map((event) => event.eventName), ["root", "standalone"]);
+        assert.equal(events[1].parentSpanId, undefined);
+    });
+
+    it("cancel reports the span as an error", () => {
+        const sampler = createSampler(1);
+
+        assert.throws(() => sampler.runSampledSpan({ eventName: "root" }, () => {
+            throw new Error("boom");
+        }));
+
+        assert.equal(events.length, 1);
+        assert.equal(events[0].category, "error");
+    });
+
+    it("guards against double reporting", () => {
+        const sampler = createSampler(1);
+
+        const span = sampler.startSpan({ eventName: "once" });
+        span.end();
+        span.end();
+        span.cancel();
+
+        assert.equal(events.length, 1);
+    });
+
+    it("restores the parent span after nested sampled spans", () => {
+        const sampler = createSampler(1);
+
+        sampler.runSampledSpan({ eventName: "outer" }, () => {
+            sampler.runSampledSpan({ eventName: "inner" }, () => {});
+            sampler.startSpan({ eventName: "sibling" }).end();
+        });
+
+        const outer = events.find((event) => event.eventName === "outer");
+        const inner = events.find((event) => event.eventName === "inner");
+        const sibling = events.find((event) => event.eventName === "sibling");
+        assert(outer !== undefined && inner !== undefined && sibling !== undefined);
+        assert.equal(inner.parentSpanId, outer.spanId);
+        assert.equal(sibling.parentSpanId, outer.spanId);
+    });
+
+    it("async spans capture their parent at start time", async () => {
+        const sampler = createSampler(1);
+
+        let pending: Promise<void> | undefined;
+        sampler.runSampledSpan({ eventName: "root" }, () => {
+            pending = sampler.runSpanAsync({ eventName: "asyncChild" }, async () => {
+                await Promise.resolve();
+            });
+        });
+        await pending;
+
+        const root = events.find((event) => event.eventName === "root");
+        const asyncChild = events.find((event) => event.eventName === "asyncChild");
+        assert(root !== undefined && asyncChild !== undefined);
+        assert.equal(asyncChild.parentSpanId, root.spanId);
+    });
+});
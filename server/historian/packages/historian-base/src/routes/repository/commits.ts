@@ -30,19 +30,22 @@ export function create(
         tenantId: string,
         authorization: string,
         sha: string,
-        count: number): Promise<git.ICommitDetails[]> {
+        count: number,
+        useCache: boolean): Promise<git.ICommitDetails[]> {
         const service = await utils.createGitService(tenantId, authorization, tenantService, cache, asyncLocalStorage);
-        return service.getCommits(sha, count);
+        return service.getCommits(sha, count, useCache);
     }
 
     router.get("/repos/:ignored?/:tenantId/commits",
         throttle(throttler, winston, commonThrottleOptions),
         (request, response, next) => {
+            const useCache = !("disableCache" in request.query);
             const commitsP = getCommits(
                 request.params.tenantId,
                 request.get("Authorization"),
                 utils.queryParamToString(request.query.sha),
-                utils.queryParamToNumber(request.query.count));
+                utils.queryParamToNumber(request.query.count),
+                useCache);
 
             utils.handleResponse(
                 commitsP,
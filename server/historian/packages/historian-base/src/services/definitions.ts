@@ -15,9 +15,14 @@ export interface ICache {
     get<T>(key: string): Promise<T>;
 
     /**
-     * Sets a cache value
+     * Sets a cache value. Optionally expires the entry after the given number of seconds.
      */
-    set<T>(key: string, value: T): Promise<void>;
+    set<T>(key: string, value: T, expireAfterSeconds?: number): Promise<void>;
+
+    /**
+     * Deletes the cached entry for the given key, if the cache supports deletion.
+     */
+    delete?(key: string): Promise<void>;
 }
 
 export interface ITenantService {
@@ -42,6 +42,10 @@ export class RedisCache implements ICache {
         }
     }
 
+    public async delete(key: string): Promise<void> {
+        await this.client.del(this.getKey(key));
+    }
+
     /**
      * Translates the input key to the one we will actually store in redis
      */
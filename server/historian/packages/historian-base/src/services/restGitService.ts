@@ -26,6 +26,13 @@ import { ICache } from "./definitions";
 const packageDetails = require("../../package.json");
 const userAgent = `Historian/${packageDetails.version}`;
 
+// Expiry for cached head commits. The head commit of a document ref is the one mutable entry
+// point into the otherwise content-addressed cache, so it gets a short lifetime as a safety
+// net against ref updates that do not flow through this cache. Ref updates that do flow
+// through keep the entry fresh, so on a hot document the whole load path - head commit, tree
+// and blobs - is served from the cache.
+const latestCommitCacheExpireAfterSeconds = 30;
+
 export interface IDocument {
     existing: boolean;
     docPrivateKey: string;
@@ -96,7 +103,7 @@ export class RestGitService {
         return this.get(`/repos/${this.getRepoPath()}/contents/${path}?${query}`);
     }
 
-    public async getCommits(sha: string, count: number): Promise<git.ICommitDetails[]> {
+    public async getCommits(sha: string, count: number, useCache: boolean = false): Promise<git.ICommitDetails[]> {
         let config;
         if (this.writeToExternalStorage) {
             const getRefParams: IGetRefParamsExternal = {
@@ -109,7 +116,21 @@ export class RestGitService {
             sha,
             config,
         });
-        return this.get(`/repos/${this.getRepoPath()}/commits?${query}`);
+        const fetch = async () =>
+            this.get<git.ICommitDetails[]>(`/repos/${this.getRepoPath()}/commits?${query}`);
+
+        // Fetching the single latest commit is the first read of every document load. Serve it
+        // from the cache when allowed - the ref write path keeps the cached entry near head, and
+        // a short expiry bounds any staleness from writes that bypassed it.
+        if (useCache && count === 1) {
+            return this.resolve(
+                this.getLatestCommitKey(sha),
+                fetch,
+                true,
+                latestCommitCacheExpireAfterSeconds);
+        }
+
+        return fetch();
     }
 
     public async getCommit(sha: string, useCache: boolean): Promise<git.ICommit> {
@@ -159,7 +180,11 @@ export class RestGitService {
         if (!this.writeToExternalStorage) {
             params.config.enabled = false;
         }
-        return this.post(`/repos/${this.getRepoPath()}/git/refs`, params);
+        const createdRef = await this.post<git.IRef>(`/repos/${this.getRepoPath()}/git/refs`, params);
+
+        this.refreshLatestCommitCache(this.getRefName(createdRef.ref), createdRef.object.sha);
+
+        return createdRef;
     }
 
     public async updateRef(ref: string, params: IPatchRefParamsExternal): Promise<git.IRef> {
@@ -167,11 +192,22 @@ export class RestGitService {
         if (!this.writeToExternalStorage) {
             params.config.enabled = false;
         }
-        return this.patch(`/repos/${this.getRepoPath()}/git/refs/${ref}`, params);
+        const updatedRef = await this.patch<git.IRef>(`/repos/${this.getRepoPath()}/git/refs/${ref}`, params);
+
+        // A ref update means a new summary is in place. Refresh the cached head commit so
+        // subsequent loads see the near-head summary without a round trip to storage.
+        this.refreshLatestCommitCache(this.getRefName(ref), updatedRef.object.sha);
+
+        return updatedRef;
     }
 
     public async deleteRef(ref: string): Promise<void> {
-        return this.delete(`/repos/${this.getRepoPath()}/git/refs/${ref}`);
+        await this.delete<void>(`/repos/${this.getRepoPath()}/git/refs/${ref}`);
+
+        const key = this.getLatestCommitKey(this.getRefName(ref));
+        this.cache.delete?.(key).catch((error) => {
+            winston.error(`Error deleting ${key} from cache`, error);
+        });
     }
 
     public async createTag(tag: git.ICreateTagParams): Promise<git.ITag> {
@@ -278,6 +314,44 @@ export class RestGitService {
             useCache);
     }
 
+    /**
+     * Refreshes the cached head commit for the given ref with the commit it now points at.
+     * Fire and forget from the ref write path; serving a slightly stale head is preferable to
+     * delaying the summary write.
+     */
+    private refreshLatestCommitCache(ref: string, sha: string) {
+        this.getCommit(sha, true).then((commit) => {
+            const commitDetails: git.ICommitDetails = {
+                url: commit.url,
+                sha: commit.sha,
+                commit: {
+                    url: commit.url,
+                    author: commit.author,
+                    committer: commit.committer,
+                    message: commit.message,
+                    tree: commit.tree,
+                },
+                parents: commit.parents,
+            };
+            this.setCache(this.getLatestCommitKey(ref), [commitDetails], latestCommitCacheExpireAfterSeconds);
+        }).catch((error) => {
+            winston.error(`Error refreshing latest commit for ${ref}`, error);
+        });
+    }
+
+    private getLatestCommitKey(ref: string): string {
+        // Scoped to the repo since refs, unlike shas, are not content addressed.
+        return `${this.getRepoPath()}:${ref}:latestCommit`;
+    }
+
+    /**
+     * Refs arrive as "[refs/]heads/<documentId>" on the write path but are looked up by plain
+     * document id on the read path; normalize to the latter for cache keys.
+     */
+    private getRefName(ref: string): string {
+        return ref.replace(/^refs\//, "").replace(/^heads\//, "");
+    }
+
     /**
      * Helper method to translate from an owner repo pair to the URL component for it. In the future we will require
      * the owner parameter. But for back compat we allow it to be optional.
@@ -326,14 +400,18 @@ export class RestGitService {
     /**
      * Caches the given key/value pair. Will log any errors with the cache.
      */
-    private setCache<T>(key: string, value: T) {
+    private setCache<T>(key: string, value: T, expireAfterSeconds?: number) {
         // Attempt to cache to Redis - log any errors but don't fail
-        this.cache.set(key, value).catch((error) => {
+        this.cache.set(key, value, expireAfterSeconds).catch((error) => {
             winston.error(`Error caching ${key} to redis`, error);
         });
     }
 
-    private async resolve<T>(key: string, fetch: () => Promise<T>, useCache: boolean): Promise<T> {
+    private async resolve<T>(
+        key: string,
+        fetch: () => Promise<T>,
+        useCache: boolean,
+        expireAfterSeconds?: number): Promise<T> {
         if (useCache) {
             // Attempt to grab the value from the cache. Log any errors but don't fail the request
             const cachedValue: T | undefined = await this.cache.get<T>(key).catch((error) => {
@@ -349,7 +427,7 @@ export class RestGitService {
             // Value is not cached - fetch it with the provided function and then cache the value
             winston.info(`Fetching ${key}`);
             const value = await fetch();
-            this.setCache(key, value);
+            this.setCache(key, value, expireAfterSeconds);
 
             return value;
         } else {
@@ -0,0 +1,127 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import assert from "assert";
+import { ITenantStorage } from "@fluidframework/server-services-core";
+import * as sinon from "sinon";
+import { RestGitService } from "../services";
+import { TestCache } from "./utils";
+
+const documentId = "testDocumentId";
+const commitSha = "testCommitSha";
+const treeSha = "testTreeSha";
+const testUrl = "http://test-historian.com";
+
+const storage: ITenantStorage = {
+    historianUrl: testUrl,
+    internalHistorianUrl: testUrl,
+    url: testUrl,
+    owner: "testOwner",
+    repository: "testRepository",
+    credentials: {
+        user: "testUser",
+        password: "testPassword",
+    },
+};
+
+const commit = {
+    sha: commitSha,
+    url: testUrl,
+    author: { name: "test", email: "test@domain.com", date: "time" },
+    committer: { name: "test", email: "test@domain.com", date: "time" },
+    message: "testMessage",
+    tree: { url: testUrl, sha: treeSha },
+    parents: [],
+};
+
+const commitDetails = {
+    url: testUrl,
+    sha: commitSha,
+    commit: {
+        url: testUrl,
+        author: commit.author,
+        committer: commit.committer,
+        message: commit.message,
+        tree: commit.tree,
+    },
+    parents: [],
+};
+
+const latestCommitKey = `${storage.owner}/${storage.repository}:${documentId}:latestCommit`;
+
+// Let fire-and-forget cache refreshes started by the call under test settle.
+const flushAsyncWork = async () => new Promise((resolve) => setImmediate(resolve));
+
+describe("RestGitService", () => {
+    describe("latest commit cache", () => {
+        let cache: TestCache;
+        let service: RestGitService;
+        let getStub: sinon.SinonStub;
+
+        beforeEach(() => {
+            cache = new TestCache();
+            service = new RestGitService(storage, cache, false);
+            getStub = sinon.stub(service as any, "get").returns(Promise.resolve([commitDetails]));
+        });
+
+        afterEach(() => {
+            getStub.restore();
+        });
+
+        it("caches the latest commit and serves repeat reads from the cache", async () => {
+            const first = await service.getCommits(documentId, 1, true);
+            await flushAsyncWork();
+            const second = await service.getCommits(documentId, 1, true);
+
+            assert.strictEqual(getStub.callCount, 1);
+            assert.deepStrictEqual(first, [commitDetails]);
+            assert.deepStrictEqual(second, [commitDetails]);
+        });
+
+        it("does not cache multi-commit reads", async () => {
+            await service.getCommits(documentId, 10, true);
+            await flushAsyncWork();
+            await service.getCommits(documentId, 10, true);
+
+            assert.strictEqual(getStub.callCount, 2);
+        });
+
+        it("bypasses the cache when asked", async () => {
+            await service.getCommits(documentId, 1, true);
+            await flushAsyncWork();
+            await service.getCommits(documentId, 1, false);
+
+            assert.strictEqual(getStub.callCount, 2);
+        });
+
+        it("refreshes the cached head commit on ref update", async () => {
+            getStub.returns(Promise.resolve(commit));
+            const patchStub = sinon.stub(service as any, "patch").returns(Promise.resolve({
+                ref: `refs/heads/${documentId}`,
+                url: testUrl,
+                object: { type: "commit", sha: commitSha, url: testUrl },
+            }));
+
+            await service.updateRef(
+                `heads/${documentId}`,
+                { force: true, sha: commitSha, config: { enabled: false } });
+            await flushAsyncWork();
+
+            assert.deepStrictEqual(await cache.get(latestCommitKey), [commitDetails]);
+            patchStub.restore();
+        });
+
+        it("drops the cached head commit on ref delete", async () => {
+            await cache.set(latestCommitKey, [commitDetails]);
+            const deleteStub = sinon.stub(service as any, "delete").returns(Promise.resolve());
+
+            await service.deleteRef(`heads/${documentId}`);
+            await flushAsyncWork();
+
+            assert.strictEqual(await cache.get(latestCommitKey), undefined);
+            deleteStub.restore();
+        });
+    });
+});
@@ -16,4 +16,8 @@ export class TestCache implements ICache {
         this.dictionary.set(key, value);
         return Promise.resolve();
     }
+    async delete(key: string): Promise<void> {
+        this.dictionary.delete(key);
+        return Promise.resolve();
+    }
 }
@@ -40,10 +40,13 @@ export class BroadcasterLambda implements IPartitionLambda {
     private pendingOffset: IQueuedMessage | undefined;
     private current = new Map<string, BroadcasterMessageBatch>();
     private messageSendingTimerId: unknown | undefined;
+    private pendingMessageCount = 0;
+    private backpressureLogged = false;
 
     constructor(
         private readonly publisher: IPublisher<ISequencedDocumentMessage | INack>,
-        protected context: IContext) {
+        protected context: IContext,
+        private readonly maxBatchSize: number = 1000) {
     }
 
     public handler(message: IQueuedMessage) {
@@ -78,7 +81,21 @@ export class BroadcasterLambda implements IPartitionLambda {
                 } else {
                     pendingBatch.messages.push(value.operation);
                 }
+
+                this.pendingMessageCount++;
+            }
+        }
+
+        // Slow emission (e.g. a backed up io server) lets pending grow without bound while kafka
+        // keeps delivering. Surface it once per build-up so operators can see the memory pressure.
+        if (this.pendingMessageCount > this.maxBatchSize * 10) {
+            if (!this.backpressureLogged) {
+                this.backpressureLogged = true;
+                this.context.log?.warn(
+                    `BroadcasterLambda: ${this.pendingMessageCount} messages pending behind a slow send`);
             }
+        } else {
+            this.backpressureLogged = false;
         }
 
         this.pendingOffset = message;
@@ -91,6 +108,7 @@ export class BroadcasterLambda implements IPartitionLambda {
         this.pending.clear();
         this.current.clear();
         this.pendingOffset = undefined;
+        this.pendingMessageCount = 0;
 
         if (this.messageSendingTimerId !== undefined) {
             clearTaskScheduleTimerFunction(this.messageSendingTimerId);
@@ -124,12 +142,28 @@ export class BroadcasterLambda implements IPartitionLambda {
             this.current = this.pending;
             this.pending = new Map<string, BroadcasterMessageBatch>();
             this.pendingOffset = undefined;
+            this.pendingMessageCount = 0;
+
+            // Bound the size of each emitted batch. A room that accumulated more ops than
+            // the limit receives multiple packed events, in order, instead of one oversized
+            // frame that stalls serialization and balloons socket buffers.
+            const outgoingBatches: [string, BroadcasterMessageBatch][] = [];
+            for (const [topic, batch] of this.current) {
+                if (batch.messages.length <= this.maxBatchSize) {
+                    outgoingBatches.push([topic, batch]);
+                } else {
+                    for (let i = 0; i < batch.messages.length; i += this.maxBatchSize) {
+                        outgoingBatches.push(
+                            [topic, { ...batch, messages: batch.messages.slice(i, i + this.maxBatchSize) }]);
+                    }
+                }
+            }
 
             // Process all the batches + checkpoint
             if (this.publisher.emitBatch) {
                 const promises: Promise<void>[] = [];
 
-                for (const [topic, batch] of this.current) {
+                for (const [topic, batch] of outgoingBatches) {
                     promises.push(this.publisher.emitBatch(topic, batch));
                 }
 
@@ -142,7 +176,7 @@ export class BroadcasterLambda implements IPartitionLambda {
             } else if (this.publisher.emit) {
                 const promises: Promise<void>[] = [];
 
-                for (const [topic, batch] of this.current) {
+                for (const [topic, batch] of outgoingBatches) {
                     promises.push(this.publisher.emit(topic, batch.event, batch.documentId, batch.messages));
                 }
 
@@ -153,7 +187,7 @@ export class BroadcasterLambda implements IPartitionLambda {
                     return;
                 }
             } else {
-                for (const [topic, batch] of this.current) {
+                for (const [topic, batch] of outgoingBatches) {
                     this.publisher.to(topic).emit(batch.event, batch.documentId, batch.messages);
                 }
             }
@@ -14,7 +14,9 @@ import {
 import { BroadcasterLambda } from "./lambda";
 
 export class BroadcasterLambdaFactory extends EventEmitter implements IPartitionLambdaFactory {
-    constructor(private readonly publisher: IPublisher) {
+    constructor(
+        private readonly publisher: IPublisher,
+        private readonly maxBatchSize?: number) {
         super();
 
         this.publisher.on("error", (error) => {
@@ -24,7 +26,7 @@ export class BroadcasterLambdaFactory extends EventEmitter implements IPartition
     }
 
     public async create(config: IPartitionLambdaConfig, context: IContext): Promise<IPartitionLambda> {
-        return new BroadcasterLambda(this.publisher, context);
+        return new BroadcasterLambda(this.publisher, context, this.maxBatchSize);
     }
 
     public async dispose(): Promise<void> {
@@ -107,6 +107,11 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
     private activityIdleTimer: any;
     private noopEvent: any;
 
+    // Checkpoint batching properties (see serviceConfiguration.deli.checkpointHeuristics)
+    private checkpointIdleTimer: any | undefined;
+    private lastCheckpointTime: number = Date.now();
+    private rawMessagesSinceCheckpoint: number = 0;
+
     // Op event properties
     private opIdleTimer: any | undefined;
     private opMaxTimeTimer: any | undefined;
@@ -172,11 +177,9 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
     }
 
     public handler(rawMessage: IQueuedMessage) {
-        let kafkaCheckpointMessage: IQueuedMessage | undefined;
-
         // In cases where we are reprocessing messages we have already checkpointed exit early
         if (rawMessage.offset <= this.logOffset) {
-            kafkaCheckpointMessage = this.getKafkaCheckpointMessage(rawMessage);
+            const kafkaCheckpointMessage = this.getKafkaCheckpointMessage(rawMessage);
             if (kafkaCheckpointMessage) {
                 this.context.checkpoint(kafkaCheckpointMessage);
             }
@@ -188,6 +191,10 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
 
         let sequencedMessageCount = 0;
 
+        // Ticketed messages are collected here and produced in a single send call below,
+        // instead of paying one producer call per message.
+        const outgoingMessages: ITicketedMessage[] = [];
+
         const boxcar = extractBoxcar(rawMessage);
 
         for (const message of boxcar.contents) {
@@ -226,16 +233,66 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
 
             // Update the msn last sent.
             this.lastSentMSN = ticketedMessage.msn;
-            this.lastSendP = this.sendToScriptorium(ticketedMessage.message);
+
+            outgoingMessages.push(ticketedMessage.message);
 
             sequencedMessageCount++;
         }
 
-        kafkaCheckpointMessage = this.getKafkaCheckpointMessage(rawMessage);
+        // Send all the ticketed messages of this batch to scriptorium in one produce call.
+        if (outgoingMessages.length > 0) {
+            this.lastSendP = this.sendToScriptorium(outgoingMessages);
+        }
+
+        const checkpointHeuristics = this.serviceConfiguration.deli.checkpointHeuristics;
+        if (checkpointHeuristics.enable) {
+            // Amortize checkpoint generation (which clones the full client list) and the database
+            // write across raw messages: checkpoint once enough messages or time accumulated, or
+            // once the partition goes idle. A missed checkpoint only widens the replay window.
+            this.rawMessagesSinceCheckpoint++;
+            if (this.rawMessagesSinceCheckpoint >= checkpointHeuristics.maxMessages ||
+                Date.now() - this.lastCheckpointTime >= checkpointHeuristics.maxTime) {
+                this.checkpointNow(rawMessage);
+            } else {
+                this.updateCheckpointIdleTimer(rawMessage);
+            }
+        } else {
+            this.checkpointNow(rawMessage);
+        }
+
+        // Start a timer to check inactivity on the document. To trigger idle client leave message,
+        // we send a noop back to alfred. The noop should trigger a client leave message if there are any.
+        this.clearActivityIdleTimer();
+        this.setActivityIdleTimer();
+
+        // Update the op event idle & max ops counter if ops were just sequenced
+        if (this.serviceConfiguration.deli.opEvent.enable && sequencedMessageCount > 0) {
+            this.updateOpIdleTimer();
+
+            const maxOps = this.serviceConfiguration.deli.opEvent.maxOps;
+            if (maxOps !== undefined) {
+                this.sequencedMessagesSinceLastOpEvent += sequencedMessageCount;
+
+                if (this.sequencedMessagesSinceLastOpEvent > maxOps) {
+                    this.emitOpEvent(OpEventType.MaxOps);
+                }
+            }
+        }
+    }
+
+    /**
+     * Generates a checkpoint for the current state and hands it off once outstanding
+     * sends complete. With checkpoint heuristics enabled this runs once per batch of
+     * raw messages rather than once per message.
+     */
+    private checkpointNow(rawMessage: IQueuedMessage) {
+        this.clearCheckpointIdleTimer();
+        this.lastCheckpointTime = Date.now();
+        this.rawMessagesSinceCheckpoint = 0;
+
+        const kafkaCheckpointMessage = this.getKafkaCheckpointMessage(rawMessage);
         const checkpoint = this.generateCheckpoint(rawMessage, kafkaCheckpointMessage);
 
-        // TODO optimize this to avoid doing per message
-        // Checkpoint the current state
         Promise.all([this.lastSendP, this.lastNoClientP]).then(
             () => {
                 if (this.lastInstruction === InstructionType.ClearCache) {
@@ -258,25 +315,6 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
                     documentId: this.documentId,
                 });
             });
-
-        // Start a timer to check inactivity on the document. To trigger idle client leave message,
-        // we send a noop back to alfred. The noop should trigger a client leave message if there are any.
-        this.clearActivityIdleTimer();
-        this.setActivityIdleTimer();
-
-        // Update the op event idle & max ops counter if ops were just sequenced
-        if (this.serviceConfiguration.deli.opEvent.enable && sequencedMessageCount > 0) {
-            this.updateOpIdleTimer();
-
-            const maxOps = this.serviceConfiguration.deli.opEvent.maxOps;
-            if (maxOps !== undefined) {
-                this.sequencedMessagesSinceLastOpEvent += sequencedMessageCount;
-
-                if (this.sequencedMessagesSinceLastOpEvent > maxOps) {
-                    this.emitOpEvent(OpEventType.MaxOps);
-                }
-            }
-        }
     }
 
     public close() {
@@ -284,6 +322,7 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
 
         this.clearActivityIdleTimer();
         this.clearNoopConsolidationTimer();
+        this.clearCheckpointIdleTimer();
 
         this.clearOpIdleTimer();
         this.clearOpMaxTimeTimer();
@@ -658,8 +697,8 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
     }
 
     // eslint-disable-next-line @typescript-eslint/promise-function-async
-    private sendToScriptorium(message: ITicketedMessage): Promise<void> {
-        return this.forwardProducer.send([message], message.tenantId, message.documentId);
+    private sendToScriptorium(messages: ITicketedMessage[]): Promise<void> {
+        return this.forwardProducer.send(messages, this.tenantId, this.documentId);
     }
 
     private async sendToAlfred(message: IRawOperationMessage) {
@@ -882,6 +921,27 @@ export class DeliLambda extends EventEmitter implements IPartitionLambda {
         }
     }
 
+    /**
+     * Reset the checkpoint idle timer
+     * Called when a raw message is processed without checkpointing, so the pending
+     * state is still flushed once the partition goes idle
+     */
+    private updateCheckpointIdleTimer(rawMessage: IQueuedMessage) {
+        this.clearCheckpointIdleTimer();
+
+        this.checkpointIdleTimer = setTimeout(() => {
+            this.checkpointIdleTimer = undefined;
+            this.checkpointNow(rawMessage);
+        }, this.serviceConfiguration.deli.checkpointHeuristics.idleTime);
+    }
+
+    private clearCheckpointIdleTimer() {
+        if (this.checkpointIdleTimer !== undefined) {
+            clearTimeout(this.checkpointIdleTimer);
+            this.checkpointIdleTimer = undefined;
+        }
+    }
+
     /**
      * Reset the op event idle timer
      * Called after a message is sequenced
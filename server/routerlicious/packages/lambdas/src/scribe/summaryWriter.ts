@@ -68,9 +68,23 @@ export class SummaryWriter implements ISummaryWriter {
     ): Promise<ISummaryWriteResponse> {
         const content = JSON.parse(op.contents) as ISummaryContent;
 
+        // The ref lookup, parent commit validation and logtail assembly (a mongo range query) are
+        // independent reads, so start them all up front and overlap their latencies instead of
+        // paying them serially. Failures are observed at the await sites below.
+        const existingRefP = this.summaryStorage.getRef(encodeURIComponent(this.documentId));
+        const parentCommitsP = Promise.all(
+            // eslint-disable-next-line @typescript-eslint/promise-function-async
+            content.parents.map((parentSummary) => this.summaryStorage.getCommit(parentSummary)));
+        parentCommitsP.catch(() => {});
+        const logTailEntriesP = this.generateLogtailEntries(
+            checkpoint.protocolState.sequenceNumber,
+            op.sequenceNumber + 1,
+            pendingOps);
+        logTailEntriesP.catch(() => {});
+
         // The summary must reference the existing summary to be valid. This guards against accidental sends of
         // two summaries at the same time. In this case the first one wins.
-        const existingRef = await this.summaryStorage.getRef(encodeURIComponent(this.documentId));
+        const existingRef = await existingRefP;
 
         if (content.head) {
             // In usual case, client always refers to last summaryAck so lastClientSummaryHead should always match.
@@ -102,8 +116,7 @@ export class SummaryWriter implements ISummaryWriter {
 
         // We also validate that the parent summary is valid
         try {
-            // eslint-disable-next-line @typescript-eslint/promise-function-async
-            await Promise.all(content.parents.map((parentSummary) => this.summaryStorage.getCommit(parentSummary)));
+            await parentCommitsP;
         } catch (e) {
             return {
                 message: {
@@ -138,8 +151,8 @@ export class SummaryWriter implements ISummaryWriter {
                 op.term ?? 1,
                 checkpoint.protocolState);
 
-        // Generate a tree of logTail starting from protocol sequence number to summarySequenceNumber
-        const logTailEntries = await this.generateLogtailEntries(checkpoint.protocolState.sequenceNumber, op.sequenceNumber + 1, pendingOps);
+        // Tree of logTail starting from protocol sequence number to summarySequenceNumber
+        const logTailEntries = await logTailEntriesP;
 
         // Create service protocol entries combining scribe and deli states.
         const serviceProtocolEntries = generateServiceProtocolEntries(
@@ -219,6 +232,14 @@ export class SummaryWriter implements ISummaryWriter {
         currentProtocolHead: number,
         checkpoint: IScribe,
         pendingOps: ISequencedOperationMessage[]): Promise<boolean> {
+        // Start the logtail assembly (a mongo range query) alongside the ref lookup - the two
+        // reads are independent.
+        const logTailEntriesP = this.generateLogtailEntries(
+            currentProtocolHead,
+            op.sequenceNumber + 1,
+            pendingOps);
+        logTailEntriesP.catch(() => {});
+
         const existingRef = await this.summaryStorage.getRef(encodeURIComponent(this.documentId));
 
         // Client assumes at least one app generated summary. To keep compatibility for now, service summary requires
@@ -228,19 +249,19 @@ export class SummaryWriter implements ISummaryWriter {
             return false;
         }
 
-        // Generate a tree of logTail starting from the last protocol state.
-        const logTailEntries = await this.generateLogtailEntries(
-            currentProtocolHead,
-            op.sequenceNumber + 1,
-            pendingOps);
+        // Fetch the last commit while the logtail finishes assembling.
+        const lastCommitP = this.summaryStorage.getCommit(existingRef.object.sha);
+
+        // Tree of logTail starting from the last protocol state.
+        const logTailEntries = await logTailEntriesP;
 
         // Create service protocol entries combining scribe and deli states.
         const serviceProtocolEntries = generateServiceProtocolEntries(
             op.additionalContent,
             JSON.stringify(checkpoint));
 
-        // Fetch the last commit and summary tree. Create new trees with logTail and serviceProtocol.
-        const lastCommit = await this.summaryStorage.getCommit(existingRef.object.sha);
+        // Create new trees with logTail and serviceProtocol alongside fetching the last summary tree.
+        const lastCommit = await lastCommitP;
         const [logTailTree, serviceProtocolTree, lastSummaryTree] = await Promise.all([
             this.summaryStorage.createTree({ entries: logTailEntries }),
             this.summaryStorage.createTree({ entries: serviceProtocolEntries }),
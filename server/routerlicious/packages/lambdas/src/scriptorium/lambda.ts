@@ -21,7 +21,8 @@ export class ScriptoriumLambda implements IPartitionLambda {
 
     constructor(
         private readonly opCollection: ICollection<any>,
-        protected context: IContext) {
+        protected context: IContext,
+        private readonly maxDbBatchSize: number = 1000) {
     }
 
     public handler(message: IQueuedMessage) {
@@ -71,11 +72,21 @@ export class ScriptoriumLambda implements IPartitionLambda {
         this.pending = temp;
         const batchOffset = this.pendingOffset;
 
+        // Flatten the per-document batches into one insert payload. Ops of the same document
+        // stay contiguous, and the whole batch goes to the database in as few unordered
+        // insertMany calls as the batch size limit allows, instead of one call per document.
+        const batchedOps: ISequencedOperationMessage[] = [];
+        for (const [, messages] of this.current) {
+            for (const message of messages) {
+                batchedOps.push(message);
+            }
+        }
+
         const allProcessed: Promise<void>[] = [];
 
         // Process all the batches + checkpoint
-        for (const [, messages] of this.current) {
-            const processP = this.processMongoCore(messages);
+        for (let i = 0; i < batchedOps.length; i += this.maxDbBatchSize) {
+            const processP = this.processMongoCore(batchedOps.slice(i, i + this.maxDbBatchSize));
             allProcessed.push(processP);
         }
 
@@ -59,6 +59,24 @@ describe("Routerlicious", () => {
                         numMessages,
                         countOps(testPublisher.to(`${testTenantId}/${testDocumentId}`).getEvents("op")));
                 });
+
+                it("Should split an oversized room batch into multiple packed events", async () => {
+                    const maxBatchSize = 3;
+                    const batchedLambda = new BroadcasterLambda(testPublisher, testContext, maxBatchSize);
+
+                    const numMessages = 10;
+                    for (let i = 0; i < numMessages; i++) {
+                        const message = messageFactory.createSequencedOperation();
+                        batchedLambda.handler(kafkaMessageFactory.sequenceMessage(message, testDocumentId));
+                    }
+                    await testContext.waitForOffset(kafkaMessageFactory.getHeadOffset(testDocumentId));
+
+                    const events = testPublisher.to(`${testTenantId}/${testDocumentId}`).getEvents("op");
+                    assert.equal(countOps(events), numMessages);
+                    for (const event of events) {
+                        assert(event.args[1].length <= maxBatchSize);
+                    }
+                });
             });
         });
     });
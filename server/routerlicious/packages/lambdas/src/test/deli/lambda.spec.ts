@@ -280,6 +280,58 @@ describe("Routerlicious", () => {
                     await quiesceWithClientsConnected();
                     assert.equal(testKafka.getLastMessage().operation.minimumSequenceNumber, 7);
                 });
+
+                it("Should batch checkpoints and flush on idle when checkpoint heuristics are enabled", async () => {
+                    const heuristicsConfig = _.cloneDeep(DefaultServiceConfiguration);
+                    heuristicsConfig.deli.checkpointHeuristics = {
+                        enable: true,
+                        idleTime: 50,
+                        maxTime: 10 * 1000,
+                        maxMessages: 1000,
+                    };
+
+                    const dbFactory = new TestDbFactory(_.cloneDeep({ documents: testData }));
+                    const mongoManager = new MongoManager(dbFactory);
+                    const database = await mongoManager.getDatabase();
+                    const collection = database.collection("documents");
+
+                    const kafka = new TestKafka();
+                    const heuristicsFactory = new DeliLambdaFactory(
+                        mongoManager,
+                        collection,
+                        new TestTenantManager(),
+                        kafka.createProducer(),
+                        new TestKafka().createProducer(),
+                        heuristicsConfig);
+                    const context = new TestContext();
+                    const heuristicsLambda = await heuristicsFactory.create(
+                        { documentId: testId, tenantId: testTenantId, leaderEpoch: 0 }, context);
+
+                    const clientFactory = new MessageFactory(testId, testClientId);
+                    const queueFactory = new KafkaMessageFactory("test", 1, false);
+                    const sleep = async (ms: number) => new Promise((resolve) => setTimeout(resolve, ms));
+
+                    await heuristicsLambda.handler(
+                        queueFactory.sequenceMessage(clientFactory.createJoin(0), testId));
+                    await heuristicsLambda.handler(
+                        queueFactory.sequenceMessage(clientFactory.create(MessageType.Operation, 1, 1), testId));
+
+                    // No kafka checkpoint should have been submitted yet - only the idle timer flushes it.
+                    assert.equal(context.offset, -1);
+                    await sleep(100);
+
+                    // Another message plus a second idle flush commits the offset of the first flush.
+                    await heuristicsLambda.handler(
+                        queueFactory.sequenceMessage(clientFactory.create(MessageType.Operation, 2, 2), testId));
+                    await context.waitForOffset(queueFactory.getHeadOffset(testId) - 1);
+
+                    const lastMessage = kafka.getLastMessage();
+                    assert.equal(lastMessage.type, SequencedOperationType);
+                    assert.equal(lastMessage.operation.sequenceNumber, 3);
+
+                    heuristicsLambda.close(LambdaCloseType.Stop);
+                    await heuristicsFactory.dispose();
+                });
             });
         });
     });
@@ -42,6 +42,18 @@ describe("Routerlicious", () => {
 
                     assert.equal(numMessages, testCollection.collection.length);
                 });
+
+                it("Should store all messages when they span multiple database batches", async () => {
+                    const batchedLambda = new ScriptoriumLambda(testCollection, testContext, 2);
+                    const numMessages = 5;
+                    for (let i = 0; i < numMessages; i++) {
+                        const message = messageFactory.createSequencedOperation();
+                        batchedLambda.handler(kafkaMessageFactory.sequenceMessage(message, testDocumentId));
+                    }
+                    await testContext.waitForOffset(kafkaMessageFactory.getHeadOffset(testDocumentId));
+
+                    assert.equal(numMessages, testCollection.collection.length);
+                });
             });
         });
     });
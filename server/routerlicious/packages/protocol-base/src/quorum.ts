@@ -88,6 +88,16 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
      */
     private readonly snapshotCache: Partial<IQuorumSnapshot> = {};
 
+    /**
+     * Snapshot entries for members and values. Each record is cloned once, at the point the
+     * underlying record is added or updated, and shared by reference across snapshots afterwards.
+     * This keeps rebuilding a snapshot to an O(size) array materialization instead of a deep clone
+     * of every record, which matters during join storms in large sessions. Consumers must treat
+     * snapshot contents as immutable, as they always should have.
+     */
+    private readonly memberSnapshots: Map<string, [string, ISequencedClient]>;
+    private readonly valueSnapshots: Map<string, [string, ICommittedProposal]>;
+
     constructor(
         members: [string, ISequencedClient][],
         proposals: [number, ISequencedProposal, string[]][],
@@ -112,6 +122,11 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
         this.values = new Map(values);
         this.pendingCommit = new Map(values
             .filter((value) => value[1].commitSequenceNumber === -1));
+
+        this.memberSnapshots = new Map(
+            cloneDeep(members).map((entry) => [entry[0], entry] as [string, [string, ISequencedClient]]));
+        this.valueSnapshots = new Map(
+            cloneDeep(values).map((entry) => [entry[0], entry] as [string, [string, ICommittedProposal]]));
     }
 
     public close() {
@@ -134,10 +149,10 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
 
     /**
      * Snapshots quorum members
-     * @returns a deep cloned array of members
+     * @returns an array of member records, cloned when membership changed rather than per snapshot
      */
     public snapshotMembers(): IQuorumSnapshot["members"] {
-        return cloneDeep(Array.from(this.members));
+        return Array.from(this.memberSnapshots.values());
     }
 
     /**
@@ -154,10 +169,10 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
 
     /**
      * Snapshots quorum values
-     * @returns a deep cloned array of values
+     * @returns an array of value records, cloned when the value changed rather than per snapshot
      */
     public snapshotValues(): IQuorumSnapshot["values"] {
-        return cloneDeep(Array.from(this.values));
+        return Array.from(this.valueSnapshots.values());
     }
 
     /**
@@ -192,6 +207,7 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
     public addMember(clientId: string, details: ISequencedClient) {
         assert(!this.members.has(clientId), 0x1ce /* `!this.members.has(${clientId})` */);
         this.members.set(clientId, details);
+        this.memberSnapshots.set(clientId, [clientId, cloneDeep(details)]);
         this.emit("addMember", clientId, details);
 
         // clear the members cache
@@ -204,6 +220,7 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
     public removeMember(clientId: string) {
         assert(this.members.has(clientId), 0x1cf /* `this.members.has(${clientId})` */);
         this.members.delete(clientId);
+        this.memberSnapshots.delete(clientId);
         this.emit("removeMember", clientId);
 
         // clear the members cache
@@ -348,6 +365,8 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
                 // emit this message
 
                 this.values.set(committedProposal.key, committedProposal);
+                this.valueSnapshots.set(committedProposal.key,
+                    [committedProposal.key, cloneDeep(committedProposal)]);
                 this.pendingCommit.set(committedProposal.key, committedProposal);
 
                 // clear the values cache
@@ -386,6 +405,9 @@ export class Quorum extends TypedEventEmitter<IQuorumEvents> implements IQuorum
                 .sort((a, b) => a.sequenceNumber - b.sequenceNumber)
                 .forEach((pendingCommit) => {
                     pendingCommit.commitSequenceNumber = message.sequenceNumber;
+                    // Re-clone rather than patching the snapshot record in place, since previously
+                    // returned snapshots share it by reference.
+                    this.valueSnapshots.set(pendingCommit.key, [pendingCommit.key, cloneDeep(pendingCommit)]);
 
                     // clear the values cache
                     this.snapshotCache.values = undefined;
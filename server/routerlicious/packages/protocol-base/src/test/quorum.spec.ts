@@ -3,6 +3,8 @@
  * Licensed under the MIT License.
  */
 
+import { strict as assert } from "assert";
+import { ISequencedClient, ISequencedDocumentMessage } from "@fluidframework/protocol-definitions";
 import { Quorum } from "../quorum";
 
 describe("Loader", () => {
@@ -25,5 +27,48 @@ describe("Loader", () => {
                 quorum.propose("hello", "world");
             });
         });
+
+        describe(".snapshot()", () => {
+            const newClient = (sequenceNumber: number): ISequencedClient =>
+                ({ client: { user: { id: `user${sequenceNumber}` } }, sequenceNumber }) as ISequencedClient;
+
+            it("Should include added members and exclude removed members", () => {
+                quorum.addMember("client1", newClient(1));
+                quorum.addMember("client2", newClient(2));
+                quorum.removeMember("client1");
+
+                const snapshot = quorum.snapshot();
+                assert.equal(snapshot.members.length, 1);
+                assert.equal(snapshot.members[0][0], "client2");
+            });
+
+            it("Should not be affected by mutation of the details passed to addMember", () => {
+                const details = newClient(1);
+                quorum.addMember("client1", details);
+                details.sequenceNumber = 999;
+
+                const snapshot = quorum.snapshot();
+                assert.equal(snapshot.members[0][1].sequenceNumber, 1);
+            });
+
+            it("Should track approval and commit of proposed values", () => {
+                quorum.addProposal("key1", "value1", 1, false, -1);
+                assert.equal(quorum.snapshot().proposals.length, 1);
+
+                // MSN advances past the proposal - it becomes an approved value.
+                quorum.updateMinimumSequenceNumber(
+                    { minimumSequenceNumber: 1, sequenceNumber: 2 } as ISequencedDocumentMessage);
+                let snapshot = quorum.snapshot();
+                assert.equal(snapshot.proposals.length, 0, "settled proposals should leave the snapshot");
+                assert.equal(snapshot.values.length, 1);
+                assert.equal(snapshot.values[0][1].commitSequenceNumber, -1);
+
+                // MSN advances past the approval - the value becomes committed.
+                quorum.updateMinimumSequenceNumber(
+                    { minimumSequenceNumber: 2, sequenceNumber: 3 } as ISequencedDocumentMessage);
+                snapshot = quorum.snapshot();
+                assert.equal(snapshot.values[0][1].commitSequenceNumber, 3);
+            });
+        });
     });
 });
@@ -87,7 +87,11 @@ export class AlfredResources implements core.IResources {
         public documentsCollectionName: string,
         public metricClientConfig: any) {
         const socketIoAdapterConfig = config.get("alfred:socketIoAdapter");
-        this.webServerFactory = new services.SocketIoWebServerFactory(this.redisConfig, socketIoAdapterConfig);
+        const nativeWebSocketConfig = config.get("alfred:nativeWebSocket");
+        this.webServerFactory = new services.SocketIoWebServerFactory(
+            this.redisConfig,
+            socketIoAdapterConfig,
+            nativeWebSocketConfig);
     }
 
     public async dispose(): Promise<void> {
@@ -108,6 +112,7 @@ export class AlfredResourcesFactory implements core.IResourcesFactory<AlfredReso
         const kafkaProducerPollIntervalMs = config.get("kafka:lib:producerPollIntervalMs");
         const kafkaNumberOfPartitions = config.get("kafka:lib:numberOfPartitions");
         const kafkaReplicationFactor = config.get("kafka:lib:replicationFactor");
+        const kafkaMaxBatchWaitMs = config.get("kafka:lib:maxBatchWaitMs");
         const producer = services.createProducer(
             kafkaLibrary,
             kafkaEndpoint,
@@ -116,7 +121,8 @@ export class AlfredResourcesFactory implements core.IResourcesFactory<AlfredReso
             false,
             kafkaProducerPollIntervalMs,
             kafkaNumberOfPartitions,
-            kafkaReplicationFactor);
+            kafkaReplicationFactor,
+            kafkaMaxBatchWaitMs);
 
         const redisConfig = config.get("redis");
         const webSocketLibrary = config.get("alfred:webSocketLib");
@@ -11,6 +11,7 @@ import { Provider } from "nconf";
 export async function create(config: Provider): Promise<IPartitionLambdaFactory> {
     const mongoUrl = config.get("mongo:endpoint") as string;
     const mongoExpireAfterSeconds = config.get("mongo:expireAfterSeconds") as number;
+    const maxDbBatchSize = config.get("scriptorium:maxDbBatchSize") as number | undefined;
     const deltasCollectionName = config.get("mongo:collectionNames:deltas");
     const createCosmosDBIndexes = config.get("mongo:createCosmosDBIndexes");
     const mongoFactory = new services.MongoDbFactory(mongoUrl);
@@ -51,5 +52,5 @@ export async function create(config: Provider): Promise<IPartitionLambdaFactory>
         }
     }
 
-    return new ScriptoriumLambdaFactory(mongoManager, opCollection);
+    return new ScriptoriumLambdaFactory(mongoManager, opCollection, maxDbBatchSize);
 }
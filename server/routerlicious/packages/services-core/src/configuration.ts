@@ -21,6 +21,23 @@ export interface IDeliServerConfiguration {
 
     // Controls how deli should track of certain op events
     opEvent: IDeliOpEventServerConfiguration;
+
+    // Controls how often deli should checkpoint
+    checkpointHeuristics: IDeliCheckpointHeuristicsServerConfiguration;
+}
+
+export interface IDeliCheckpointHeuristicsServerConfiguration {
+    // Enables checkpointing based on the heuristics
+    enable: boolean;
+
+    // Checkpoints after not processing any messages for this amount of time
+    idleTime: number;
+
+    // Checkpoints after this amount of time since the last checkpoint
+    maxTime: number;
+
+    // Checkpoints after processing this amount of raw kafka messages since the last checkpoint
+    maxMessages: number;
 }
 
 export interface IDeliOpEventServerConfiguration {
@@ -131,6 +148,12 @@ export const DefaultServiceConfiguration: IServiceConfiguration = {
             maxTime: 5 * 60 * 1000,
             maxOps: 1500,
         },
+        checkpointHeuristics: {
+            enable: false,
+            idleTime: 10 * 1000,
+            maxTime: 1 * 60 * 1000,
+            maxMessages: 500,
+        },
     },
     scribe: {
         generateServiceSummary: true,
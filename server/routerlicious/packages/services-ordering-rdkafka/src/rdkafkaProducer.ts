@@ -18,6 +18,13 @@ import { IKafkaBaseOptions, IKafkaEndpoints, RdkafkaBase } from "./rdkafkaBase";
 export interface IKafkaProducerOptions extends Partial<IKafkaBaseOptions> {
 	enableIdempotence: boolean;
 	pollIntervalMs: number;
+	/**
+	 * How long to buffer incoming messages before producing the pending boxcars, in milliseconds.
+	 * A small window aggregates more submissions per boxcar under load, reducing per-produce
+	 * overhead at the cost of added latency. 0 (the default) produces on the next immediate,
+	 * preserving the previous behavior. Full boxcars are always produced right away.
+	 */
+	maxBatchWaitMs: number;
 	additionalOptions?: kafkaTypes.ProducerGlobalConfig;
 	topicConfig?: kafkaTypes.ProducerTopicConfig;
 }
@@ -29,7 +36,7 @@ export class RdkafkaProducer extends RdkafkaBase implements IProducer {
 	private readonly producerOptions: IKafkaProducerOptions;
 	private readonly messages = new Map<string, IPendingBoxcar[]>();
 	private producer?: kafkaTypes.Producer;
-	private sendPending?: NodeJS.Immediate;
+	private sendPending?: NodeJS.Immediate | NodeJS.Timeout;
 	private connecting = false;
 	private connected = false;
 	private closed = false;
@@ -45,6 +52,7 @@ export class RdkafkaProducer extends RdkafkaBase implements IProducer {
 			...options,
 			enableIdempotence: options?.enableIdempotence ?? false,
 			pollIntervalMs: options?.pollIntervalMs ?? 10,
+			maxBatchWaitMs: options?.maxBatchWaitMs ?? 0,
 		};
 	}
 
@@ -129,7 +137,11 @@ export class RdkafkaProducer extends RdkafkaBase implements IProducer {
 		this.connecting = this.connected = false;
 
 		if (this.sendPending) {
-			clearImmediate(this.sendPending);
+			if (this.producerOptions.maxBatchWaitMs > 0) {
+				clearTimeout(this.sendPending as NodeJS.Timeout);
+			} else {
+				clearImmediate(this.sendPending as NodeJS.Immediate);
+			}
 			this.sendPending = undefined;
 		}
 
@@ -212,24 +224,68 @@ export class RdkafkaProducer extends RdkafkaBase implements IProducer {
 			return;
 		}
 
-		// Use setImmediate to play well with the node event loop
-		this.sendPending = setImmediate(() => {
-			this.sendPendingMessages();
+		const sendPendingMessages = () => {
 			this.sendPending = undefined;
-		});
+			this.sendPendingMessages();
+		};
+
+		if (this.producerOptions.maxBatchWaitMs > 0) {
+			// Buffer incoming messages for the configured window to aggregate more of them per boxcar
+			this.sendPending = setTimeout(sendPendingMessages, this.producerOptions.maxBatchWaitMs);
+		} else {
+			// Use setImmediate to play well with the node event loop
+			this.sendPending = setImmediate(sendPendingMessages);
+		}
 	}
 
 	/**
-	 * Sends all pending messages
+	 * Sends all pending messages.
+	 * Boxcars are interleaved across tenants, and across documents within a tenant, so that one
+	 * chatty document with many pending boxcars cannot enqueue all of them ahead of everyone
+	 * else's in the outgoing queue. Boxcars of the same document keep their relative order, which
+	 * preserves per-document ordering.
 	 */
 	private sendPendingMessages() {
-		const messages = Array.from(this.messages.values());
+		// Group the per-document boxcar lists by tenant
+		const tenantBoxcarQueues = new Map<string, IPendingBoxcar[][]>();
+		for (const boxcars of this.messages.values()) {
+			const tenantId = boxcars[0].tenantId;
+			let queues = tenantBoxcarQueues.get(tenantId);
+			if (queues === undefined) {
+				queues = [];
+				tenantBoxcarQueues.set(tenantId, queues);
+			}
+			queues.push(boxcars);
+		}
 
 		// clear messages now because sendBoxcars may insert some
 		this.messages.clear();
 
-		for (const message of messages) {
-			this.sendBoxcars(message);
+		// Within each tenant, interleave one boxcar per document per round
+		const tenantQueues: IPendingBoxcar[][] = [];
+		for (const queues of tenantBoxcarQueues.values()) {
+			const interleaved: IPendingBoxcar[] = [];
+			for (let index = 0, added = true; added; index++) {
+				added = false;
+				for (const queue of queues) {
+					if (index < queue.length) {
+						interleaved.push(queue[index]);
+						added = true;
+					}
+				}
+			}
+			tenantQueues.push(interleaved);
+		}
+
+		// Across tenants, produce one boxcar per tenant per round
+		for (let index = 0, added = true; added; index++) {
+			added = false;
+			for (const queue of tenantQueues) {
+				if (index < queue.length) {
+					this.sendBoxcars([queue[index]]);
+					added = true;
+				}
+			}
 		}
 	}
 
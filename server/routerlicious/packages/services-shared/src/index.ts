@@ -3,6 +3,7 @@
  * Licensed under the MIT License.
  */
 
+export * from "./nativeWebSocketServer";
 export * from "./redisSocketIoAdapter";
 export * from "./runner";
 export * from "./storage";
@@ -0,0 +1,266 @@
+/*!
+ * Copyright (c) Microsoft Corporation and contributors. All rights reserved.
+ * Licensed under the MIT License.
+ */
+
+import { EventEmitter } from "events";
+import * as http from "http";
+import * as util from "util";
+import * as core from "@fluidframework/server-services-core";
+import * as _ from "lodash";
+import Redis from "ioredis";
+import * as msgpack from "notepack.io";
+import * as uuid from "uuid";
+import * as winston from "winston";
+import ws from "ws";
+import { SocketIORedisConnection, SocketIoRedisSubscriptionConnection } from "./socketIoRedisConnection";
+
+/**
+ * Configuration for the native WebSocket delta stream endpoint.
+ */
+export interface INativeWebSocketServerConfig {
+    enabled: boolean;
+    // Path the endpoint is mounted on within the shared http server. Default: "/fluid-ws".
+    path?: string;
+}
+
+export const defaultNativeWebSocketPath = "/fluid-ws";
+
+// Connections live on the default namespace, matching what socket.io clients connect to.
+// The Redis channel naming is compatible with socket.io-redis / RedisSocketIoAdapter so that
+// ops published by scriptorium (and signals emitted by socket.io frontends) reach native
+// sockets, and vice versa.
+const namespaceName = "/";
+const channelPrefix = `socket.io#${namespaceName}#`;
+
+// socket.io packet type for an event packet.
+const eventPacketType = 2;
+
+/**
+ * A raw WebSocket connection speaking a minimal framing: text frames are JSON encoded
+ * "[event, ...args]" arrays mirroring socket.io's event packets. permessage-deflate is
+ * negotiated at the transport level, so large op frames compress on the wire without the
+ * socket.io/engine.io protocol layers.
+ */
+class NativeWebSocket implements core.IWebSocket {
+    private readonly events = new EventEmitter();
+    public readonly rooms = new Set<string>();
+
+    constructor(
+        public readonly id: string,
+        private readonly socket: ws,
+        private readonly server: NativeWebSocketServer) {
+        this.socket.on("message", (data) => this.handleMessage(data));
+        this.socket.on("close", () => {
+            this.server.removeSocket(this);
+            this.events.emit("disconnect");
+        });
+        this.socket.on("error", (error) => this.events.emit("error", error));
+    }
+
+    public on(event: string, listener: (...args: any[]) => void) {
+        this.events.on(event, listener);
+    }
+
+    public async join(id: string): Promise<void> {
+        await this.server.joinRoom(this, id);
+        this.rooms.add(id);
+    }
+
+    public async emit(event: string, ...args: any[]) {
+        this.send([event, ...args]);
+    }
+
+    public async emitToRoom(roomId: string, event: string, ...args: any[]) {
+        await this.server.emitToRoom(roomId, event, ...args);
+    }
+
+    public disconnect(close?: boolean) {
+        this.socket.close();
+    }
+
+    public send(frame: any[]) {
+        if (this.socket.readyState === ws.OPEN) {
+            this.socket.send(JSON.stringify(frame));
+        }
+    }
+
+    private handleMessage(data: ws.Data) {
+        let frame: any;
+        try {
+            frame = JSON.parse(data.toString());
+        } catch {
+            this.events.emit("error", new Error("Invalid message frame"));
+            return;
+        }
+
+        if (Array.isArray(frame) && typeof frame[0] === "string") {
+            this.events.emit(frame[0], ...frame.slice(1));
+        }
+    }
+}
+
+class NativeWebSocketServer implements core.IWebSocketServer {
+    private readonly events = new EventEmitter();
+    private readonly rooms = new Map<string, Set<NativeWebSocket>>();
+
+    // Uid identifying this server instance in published messages, so messages looped back by
+    // Redis are not delivered twice. Same scheme as RedisSocketIoAdapter.
+    private readonly uid: string = uuid.v4().substring(0, 6);
+
+    constructor(
+        private readonly webSocketServer: ws.Server,
+        private readonly pubConnection: SocketIORedisConnection,
+        private readonly subConnection: SocketIoRedisSubscriptionConnection,
+        private readonly pub: Redis.Redis,
+        private readonly sub: Redis.Redis) {
+        this.webSocketServer.on("connection", (socket: ws) => {
+            const webSocket = new NativeWebSocket(uuid.v4(), socket, this);
+            this.events.emit("connection", webSocket);
+        });
+    }
+
+    public on(event: string, listener: (...args: any[]) => void) {
+        this.events.on(event, listener);
+    }
+
+    public async joinRoom(socket: NativeWebSocket, roomId: string): Promise<void> {
+        let members = this.rooms.get(roomId);
+        if (members === undefined) {
+            members = new Set();
+            this.rooms.set(roomId, members);
+        }
+        members.add(socket);
+
+        await this.subConnection.subscribe(
+            `${channelPrefix}${roomId}#`,
+            (channel, messageBuffer) => this.onRoomMessage(channel, messageBuffer));
+    }
+
+    public removeSocket(socket: NativeWebSocket) {
+        for (const roomId of socket.rooms) {
+            const members = this.rooms.get(roomId);
+            if (members === undefined) {
+                continue;
+            }
+
+            members.delete(socket);
+            if (members.size === 0) {
+                this.rooms.delete(roomId);
+                this.subConnection.unsubscribe(`${channelPrefix}${roomId}#`).catch((error) => {
+                    winston.error(`Error unsubscribing from room ${roomId}`, error);
+                });
+            }
+        }
+    }
+
+    public async emitToRoom(roomId: string, event: string, ...args: any[]): Promise<void> {
+        // Deliver to local members directly, then publish for socket.io members and other
+        // server instances. Messages we published ourselves are skipped in onRoomMessage.
+        this.deliverToRoom(roomId, [event, ...args]);
+
+        const packet = {
+            type: eventPacketType,
+            data: [event, ...args],
+            nsp: namespaceName,
+        };
+        const message = msgpack.encode([this.uid, packet, { rooms: [roomId] }]);
+        await this.pubConnection.publish(`${channelPrefix}${roomId}#`, message);
+    }
+
+    public async close(): Promise<void> {
+        const pubClosedP = util.promisify(((callback) => this.pub.quit(callback)) as any)();
+        const subClosedP = util.promisify(((callback) => this.sub.quit(callback)) as any)();
+        const wsClosedP = util.promisify(((callback) => this.webSocketServer.close(callback)) as any)();
+        await Promise.all([pubClosedP, subClosedP, wsClosedP]);
+    }
+
+    private onRoomMessage(channel: string, messageBuffer: Buffer) {
+        if (!channel.startsWith(channelPrefix)) {
+            // sent to different channel
+            return;
+        }
+
+        const roomId = channel.slice(channelPrefix.length, -1);
+
+        let args: any[];
+        try {
+            args = msgpack.decode(messageBuffer);
+        } catch {
+            // not a message we understand
+            return;
+        }
+
+        const messageUid = args.shift();
+        const packet = args[0];
+
+        // Skip our own messages (already delivered locally) and health check packets sent by
+        // the socket.io adapter (a plain string in place of the packet).
+        if (messageUid === this.uid || typeof packet === "string") {
+            return;
+        }
+
+        if (!packet || !Array.isArray(packet.data)) {
+            return;
+        }
+
+        if (packet.nsp !== undefined && packet.nsp !== namespaceName) {
+            // ignoring different namespace
+            return;
+        }
+
+        this.deliverToRoom(roomId, packet.data);
+    }
+
+    private deliverToRoom(roomId: string, frame: any[]) {
+        const members = this.rooms.get(roomId);
+        if (members === undefined) {
+            return;
+        }
+
+        for (const member of members) {
+            member.send(frame);
+        }
+    }
+}
+
+export function create(
+    redisConfig: any,
+    server: http.Server,
+    config?: INativeWebSocketServerConfig): core.IWebSocketServer {
+    const options: Redis.RedisOptions = {
+        host: redisConfig.host,
+        port: redisConfig.port,
+        password: redisConfig.pass,
+    };
+    if (redisConfig.tls) {
+        options.tls = {
+            servername: redisConfig.host,
+        };
+    }
+
+    const pub = new Redis(_.clone(options));
+    const sub = new Redis(_.clone(options));
+
+    pub.on("error", (err) => {
+        winston.error("Error with Redis pub connection: ", err);
+    });
+    sub.on("error", (err) => {
+        winston.error("Error with Redis sub connection: ", err);
+    });
+
+    const pubConnection = new SocketIORedisConnection(pub);
+    const subConnection = new SocketIoRedisSubscriptionConnection(sub);
+
+    const webSocketServer = new ws.Server({
+        server,
+        path: config?.path ?? defaultNativeWebSocketPath,
+        // Negotiate permessage-deflate so large op frames compress on the wire. Small frames
+        // are sent as-is to avoid the compression overhead for keepalives and signals.
+        perMessageDeflate: {
+            threshold: 1024,
+        },
+    });
+
+    return new NativeWebSocketServer(webSocketServer, pubConnection, subConnection, pub, sub);
+}
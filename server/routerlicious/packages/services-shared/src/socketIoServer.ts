@@ -77,7 +77,8 @@ class SocketIoServer implements core.IWebSocketServer {
 export function create(
     redisConfig: any,
     server: http.Server,
-    socketIoAdapterConfig?: any): core.IWebSocketServer {
+    socketIoAdapterConfig?: any,
+    allowForeignUpgradePaths = false): core.IWebSocketServer {
     const options: Redis.RedisOptions = {
         host: redisConfig.host,
         port: redisConfig.port,
@@ -126,7 +127,10 @@ export function create(
         adapter = socketIoRedis({ pubClient: pub, subClient: sub });
     }
 
-    io.attach(server);
+    // By default engine.io destroys upgrade requests for paths it does not own. Leave them
+    // alone when another websocket server (e.g. the native delta stream endpoint) shares
+    // this http server.
+    io.attach(server, { destroyUpgrade: !allowForeignUpgradePaths } as any);
     io.adapter(adapter);
 
     return new SocketIoServer(io, pub, sub);
@@ -7,6 +7,7 @@ import * as http from "http";
 import { AddressInfo } from "net";
 import * as util from "util";
 import * as core from "@fluidframework/server-services-core";
+import * as nativeWebSocket from "./nativeWebSocketServer";
 import * as socketIo from "./socketIoServer";
 
 export type RequestListener = (request: http.IncomingMessage, response: http.ServerResponse) => void;
@@ -46,8 +47,31 @@ export class WebServer implements core.IWebServer {
     }
 }
 
+/**
+ * Presents multiple websocket servers sharing one http server as a single
+ * IWebSocketServer, so consumers configure connection handling once regardless
+ * of the transport a client connected over.
+ */
+export class CompositeWebSocketServer implements core.IWebSocketServer {
+    constructor(private readonly servers: core.IWebSocketServer[]) {
+    }
+
+    public on(event: string, listener: (...args: any[]) => void) {
+        for (const server of this.servers) {
+            server.on(event, listener);
+        }
+    }
+
+    public async close(): Promise<void> {
+        await Promise.all(this.servers.map(async (server) => server.close()));
+    }
+}
+
 export class SocketIoWebServerFactory implements core.IWebServerFactory {
-    constructor(private readonly redisConfig: any, private readonly socketIoAdapterConfig?: any) {
+    constructor(
+        private readonly redisConfig: any,
+        private readonly socketIoAdapterConfig?: any,
+        private readonly nativeWebSocketConfig?: nativeWebSocket.INativeWebSocketServerConfig) {
     }
 
     public create(requestListener: RequestListener): core.IWebServer {
@@ -55,9 +79,21 @@ export class SocketIoWebServerFactory implements core.IWebServerFactory {
         const server = http.createServer(requestListener);
         const httpServer = new HttpServer(server);
 
-        const socketIoServer = socketIo.create(this.redisConfig, server, this.socketIoAdapterConfig);
+        const nativeEnabled = this.nativeWebSocketConfig?.enabled === true;
+
+        let webSocketServer = socketIo.create(
+            this.redisConfig,
+            server,
+            this.socketIoAdapterConfig,
+            nativeEnabled /* allowForeignUpgradePaths */);
+
+        if (nativeEnabled) {
+            // Mount the native WebSocket endpoint on the same http server, on its own path.
+            const nativeServer = nativeWebSocket.create(this.redisConfig, server, this.nativeWebSocketConfig);
+            webSocketServer = new CompositeWebSocketServer([webSocketServer, nativeServer]);
+        }
 
-        return new WebServer(httpServer, socketIoServer);
+        return new WebServer(httpServer, webSocketServer);
     }
 }
 
@@ -41,7 +41,8 @@ export function createProducer(
     enableIdempotence?: boolean,
     pollIntervalMs?: number,
     numberOfPartitions?: number,
-    replicationFactor?: number): IProducer {
+    replicationFactor?: number,
+    maxBatchWaitMs?: number): IProducer {
     let producer: IProducer;
 
     if (type === "rdkafka") {
@@ -49,7 +50,7 @@ export function createProducer(
             { kafka: [kafkaEndPoint] },
             clientId,
             topic,
-            { enableIdempotence, pollIntervalMs, numberOfPartitions, replicationFactor });
+            { enableIdempotence, pollIntervalMs, numberOfPartitions, replicationFactor, maxBatchWaitMs });
 
         producer.on("error", (error, errorData: IContextErrorData) => {
             if (errorData?.restart) {